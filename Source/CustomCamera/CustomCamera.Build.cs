@@ -27,7 +27,8 @@ public class CustomCamera : ModuleRules
             "RHI",
             "AudioMixer",   // For audio effects
             "MediaAssets",  // For post-processing
-            "CinematicCamera" // For advanced camera features
+            "CinematicCamera", // For advanced camera features
+            "KryoDebug"        // Debug visualization, compiled out of Shipping and Test
         });
 
         // Editor-specific dependencies
@@ -0,0 +1,83 @@
+#include "CameraEffectTimeline.h"
+#include "Curves/CurveFloat.h"
+
+float FCameraTimelineEffect::Sample(float NormalizedTime) const
+{
+    const float Position = FMath::Clamp(NormalizedTime, 0.0f, 1.0f) * (LUTSize - 1);
+    const int32 Index = FMath::Min(FMath::FloorToInt(Position), LUTSize - 2);
+    return FMath::Lerp(LUT[Index], LUT[Index + 1], Position - Index);
+}
+
+int32 FCameraEffectTimeline::Play(ECameraEffectChannel Channel, float StartTime, float Duration, float Scale, const UCurveFloat* Curve, bool bHoldAtEnd,
+    ECameraEffectShape DefaultShape)
+{
+    FCameraTimelineEffect& Effect = Effects.AddDefaulted_GetRef();
+    Effect.Handle = NextHandle++;
+    Effect.Channel = Channel;
+    Effect.StartTime = StartTime;
+    Effect.Duration = FMath::Max(Duration, KINDA_SMALL_NUMBER);
+    Effect.Scale = Scale;
+    Effect.bHoldAtEnd = bHoldAtEnd;
+    BakeCurve(Effect, Curve, DefaultShape);
+    return Effect.Handle;
+}
+
+void FCameraEffectTimeline::Stop(int32 Handle)
+{
+    Effects.RemoveAllSwap([Handle](const FCameraTimelineEffect& Effect) { return Effect.Handle == Handle; }, false);
+}
+
+void FCameraEffectTimeline::StopChannel(ECameraEffectChannel Channel)
+{
+    Effects.RemoveAllSwap([Channel](const FCameraTimelineEffect& Effect) { return Effect.Channel == Channel; }, false);
+}
+
+void FCameraEffectTimeline::Reset()
+{
+    Effects.Reset();
+}
+
+FCameraEffectChannels FCameraEffectTimeline::Evaluate(float WorldTime)
+{
+    FCameraEffectChannels Channels;
+
+    for (int32 Index = Effects.Num() - 1; Index >= 0; --Index)
+    {
+        const FCameraTimelineEffect& Effect = Effects[Index];
+        const float NormalizedTime = (WorldTime - Effect.StartTime) / Effect.Duration;
+        if (NormalizedTime >= 1.0f && !Effect.bHoldAtEnd)
+        {
+            Effects.RemoveAtSwap(Index, 1, false);
+            continue;
+        }
+
+        const int32 ChannelIndex = static_cast<int32>(Effect.Channel);
+        Channels.Values[ChannelIndex] += Effect.Sample(NormalizedTime) * Effect.Scale;
+        Channels.ActiveMask |= 1u << ChannelIndex;
+    }
+
+    return Channels;
+}
+
+void FCameraEffectTimeline::BakeCurve(FCameraTimelineEffect& Effect, const UCurveFloat* Curve, ECameraEffectShape DefaultShape)
+{
+    float MinTime = 0.0f;
+    float MaxTime = 1.0f;
+    if (Curve)
+    {
+        Curve->GetTimeRange(MinTime, MaxTime);
+    }
+
+    for (int32 Index = 0; Index < FCameraTimelineEffect::LUTSize; ++Index)
+    {
+        const float Alpha = static_cast<float>(Index) / (FCameraTimelineEffect::LUTSize - 1);
+        if (Curve)
+        {
+            Effect.LUT[Index] = Curve->GetFloatValue(FMath::Lerp(MinTime, MaxTime, Alpha));
+        }
+        else
+        {
+            Effect.LUT[Index] = DefaultShape == ECameraEffectShape::Pulse ? FMath::Sin(UE_PI * Alpha) : Alpha;
+        }
+    }
+}
@@ -0,0 +1,260 @@
+#include "CameraFramingSet.h"
+#include "GameFramework/Actor.h"
+#include "Math/VectorRegister.h"
+
+namespace
+{
+    FORCEINLINE float HorizontalMin(const VectorRegister4Float& Value)
+    {
+        alignas(16) float Lanes[4];
+        VectorStoreAligned(Value, Lanes);
+        return FMath::Min(FMath::Min(Lanes[0], Lanes[1]), FMath::Min(Lanes[2], Lanes[3]));
+    }
+
+    FORCEINLINE float HorizontalMax(const VectorRegister4Float& Value)
+    {
+        alignas(16) float Lanes[4];
+        VectorStoreAligned(Value, Lanes);
+        return FMath::Max(FMath::Max(Lanes[0], Lanes[1]), FMath::Max(Lanes[2], Lanes[3]));
+    }
+
+    FORCEINLINE VectorRegister4Float Dot3(const VectorRegister4Float& X, const VectorRegister4Float& Y, const VectorRegister4Float& Z, const FVector3f& Axis)
+    {
+        return VectorMultiplyAdd(Z, VectorSetFloat1(Axis.Z), VectorMultiplyAdd(Y, VectorSetFloat1(Axis.Y), VectorMultiply(X, VectorSetFloat1(Axis.X))));
+    }
+
+    // Half angle that fits a sphere at lateral offset Lateral and depth Depth in front of the camera
+    FORCEINLINE VectorRegister4Float FittingHalfAngle(const VectorRegister4Float& Lateral, const VectorRegister4Float& Depth, const VectorRegister4Float& Radius)
+    {
+        const VectorRegister4Float Range = VectorSqrt(VectorMax(VectorMultiplyAdd(Depth, Depth, VectorMultiply(Lateral, Lateral)), VectorSetFloat1(UE_SMALL_NUMBER)));
+        const VectorRegister4Float Spread = VectorASin(VectorMin(VectorDivide(Radius, Range), VectorOneFloat()));
+        return VectorAdd(VectorATan2(Lateral, Depth), Spread);
+    }
+}
+
+bool FCameraFramingSet::Add(const AActor* Actor, float Radius)
+{
+    if (!Actor)
+    {
+        return false;
+    }
+
+    for (FTarget& Target : Targets)
+    {
+        if (Target.Actor == Actor)
+        {
+            Target.Radius = FMath::Max(Radius, 0.0f);
+            return true;
+        }
+    }
+
+    if (Targets.Num() >= Capacity)
+    {
+        return false;
+    }
+
+    FTarget& Target = Targets.AddDefaulted_GetRef();
+    Target.Actor = Actor;
+    Target.Radius = FMath::Max(Radius, 0.0f);
+    return true;
+}
+
+bool FCameraFramingSet::Remove(const AActor* Actor)
+{
+    for (int32 Index = 0; Index < Targets.Num(); ++Index)
+    {
+        if (Targets[Index].Actor == Actor)
+        {
+            Targets.RemoveAtSwap(Index, 1, false);
+            return true;
+        }
+    }
+    return false;
+}
+
+void FCameraFramingSet::Reset()
+{
+    Targets.Reset();
+    NumPoints = 0;
+}
+
+void FCameraFramingSet::SetLane(int32 Lane, const FVector& Location, float Radius)
+{
+    // Relative to the first point so large world coordinates survive the trip through float
+    if (Lane == 0)
+    {
+        Origin = Location;
+    }
+
+    const FVector Local = Location - Origin;
+    PointX[Lane] = static_cast<float>(Local.X);
+    PointY[Lane] = static_cast<float>(Local.Y);
+    PointZ[Lane] = static_cast<float>(Local.Z);
+    PointRadius[Lane] = Radius;
+}
+
+int32 FCameraFramingSet::Gather(bool bIncludeExtra, const FVector& ExtraLocation, float ExtraRadius)
+{
+    NumPoints = 0;
+    if (bIncludeExtra)
+    {
+        SetLane(NumPoints++, ExtraLocation, ExtraRadius);
+    }
+
+    for (int32 Index = Targets.Num() - 1; Index >= 0; --Index)
+    {
+        const AActor* Actor = Targets[Index].Actor.Get();
+        if (!Actor)
+        {
+            Targets.RemoveAtSwap(Index, 1, false);
+            continue;
+        }
+
+        if (NumPoints < Capacity)
+        {
+            SetLane(NumPoints++, Actor->GetActorLocation(), Targets[Index].Radius);
+        }
+    }
+
+    PadLanes();
+    return NumPoints;
+}
+
+int32 FCameraFramingSet::GatherPoints(TArrayView<const FSphere> Points)
+{
+    NumPoints = FMath::Min(Points.Num(), Capacity);
+    for (int32 Lane = 0; Lane < NumPoints; ++Lane)
+    {
+        SetLane(Lane, Points[Lane].Center, FMath::Max(static_cast<float>(Points[Lane].W), 0.0f));
+    }
+
+    PadLanes();
+    return NumPoints;
+}
+
+void FCameraFramingSet::PadLanes()
+{
+    // Pad the last group of four with copies of the first point; duplicates don't change any extent
+    for (int32 Lane = NumPoints; NumPoints > 0 && Lane < Align(NumPoints, 4); ++Lane)
+    {
+        PointX[Lane] = PointX[0];
+        PointY[Lane] = PointY[0];
+        PointZ[Lane] = PointZ[0];
+        PointRadius[Lane] = PointRadius[0];
+    }
+}
+
+bool FCameraFramingSet::Solve(const FQuat& ViewRotation, float FieldOfView, float AspectRatio, const FCameraFramingSettings& Settings, FCameraFramingSolution& OutSolution) const
+{
+    if (NumPoints == 0)
+    {
+        return false;
+    }
+
+    const int32 NumLanes = Align(NumPoints, 4);
+
+    // Pass 1: bounds of every sphere; the box centre is the bounding sphere's centre
+    VectorRegister4Float MinX = VectorSetFloat1(UE_BIG_NUMBER), MinY = MinX, MinZ = MinX;
+    VectorRegister4Float MaxX = VectorSetFloat1(-UE_BIG_NUMBER), MaxY = MaxX, MaxZ = MaxX;
+    for (int32 Lane = 0; Lane < NumLanes; Lane += 4)
+    {
+        const VectorRegister4Float X = VectorLoadAligned(&PointX[Lane]);
+        const VectorRegister4Float Y = VectorLoadAligned(&PointY[Lane]);
+        const VectorRegister4Float Z = VectorLoadAligned(&PointZ[Lane]);
+        const VectorRegister4Float R = VectorLoadAligned(&PointRadius[Lane]);
+        MinX = VectorMin(MinX, VectorSubtract(X, R));
+        MinY = VectorMin(MinY, VectorSubtract(Y, R));
+        MinZ = VectorMin(MinZ, VectorSubtract(Z, R));
+        MaxX = VectorMax(MaxX, VectorAdd(X, R));
+        MaxY = VectorMax(MaxY, VectorAdd(Y, R));
+        MaxZ = VectorMax(MaxZ, VectorAdd(Z, R));
+    }
+
+    const FVector3f Center(
+        0.5f * (HorizontalMin(MinX) + HorizontalMax(MaxX)),
+        0.5f * (HorizontalMin(MinY) + HorizontalMax(MaxY)),
+        0.5f * (HorizontalMin(MinZ) + HorizontalMax(MaxZ)));
+
+    // The margin shrinks the usable half angles
+    const float Usable = 1.0f - FMath::Clamp(Settings.ScreenMargin, 0.0f, 0.9f);
+    const float TanHalfHorizontal = FMath::Tan(FMath::DegreesToRadians(FMath::Clamp(FieldOfView, 1.0f, 170.0f) * 0.5f)) * Usable;
+    const float TanHalfVertical = TanHalfHorizontal / FMath::Max(AspectRatio, UE_KINDA_SMALL_NUMBER);
+    const float HalfHorizontal = FMath::Atan(TanHalfHorizontal);
+    const float HalfVertical = FMath::Atan(TanHalfVertical);
+
+    const FVector3f Forward(ViewRotation.GetForwardVector());
+    const FVector3f Right(ViewRotation.GetRightVector());
+    const FVector3f Up(ViewRotation.GetUpVector());
+
+    // Pass 2: bounding radius, view-space extents and the distance at which each sphere clears the side planes:
+    // depth * sin(half) - |lateral| * cos(half) >= r  =>  distance >= |lateral| / tan(half) + r / sin(half) - depth offset
+    const VectorRegister4Float Zero = VectorZeroFloat();
+    const VectorRegister4Float InvTanH = VectorSetFloat1(1.0f / TanHalfHorizontal);
+    const VectorRegister4Float InvSinH = VectorSetFloat1(1.0f / FMath::Sin(HalfHorizontal));
+    const VectorRegister4Float InvTanV = VectorSetFloat1(1.0f / TanHalfVertical);
+    const VectorRegister4Float InvSinV = VectorSetFloat1(1.0f / FMath::Sin(HalfVertical));
+    VectorRegister4Float MaxRadius = Zero;
+    VectorRegister4Float MaxHalfWidth = Zero;
+    VectorRegister4Float MaxHalfHeight = Zero;
+    VectorRegister4Float MaxDistance = VectorSetFloat1(-UE_BIG_NUMBER);
+    for (int32 Lane = 0; Lane < NumLanes; Lane += 4)
+    {
+        const VectorRegister4Float DX = VectorSubtract(VectorLoadAligned(&PointX[Lane]), VectorSetFloat1(Center.X));
+        const VectorRegister4Float DY = VectorSubtract(VectorLoadAligned(&PointY[Lane]), VectorSetFloat1(Center.Y));
+        const VectorRegister4Float DZ = VectorSubtract(VectorLoadAligned(&PointZ[Lane]), VectorSetFloat1(Center.Z));
+        const VectorRegister4Float R = VectorLoadAligned(&PointRadius[Lane]);
+
+        const VectorRegister4Float LengthSquared = VectorMultiplyAdd(DZ, DZ, VectorMultiplyAdd(DY, DY, VectorMultiply(DX, DX)));
+        MaxRadius = VectorMax(MaxRadius, VectorAdd(VectorSqrt(LengthSquared), R));
+
+        const VectorRegister4Float Lateral = VectorAbs(Dot3(DX, DY, DZ, Right));
+        const VectorRegister4Float Vertical = VectorAbs(Dot3(DX, DY, DZ, Up));
+        const VectorRegister4Float Depth = Dot3(DX, DY, DZ, Forward);
+        MaxHalfWidth = VectorMax(MaxHalfWidth, VectorAdd(Lateral, R));
+        MaxHalfHeight = VectorMax(MaxHalfHeight, VectorAdd(Vertical, R));
+
+        const VectorRegister4Float HorizontalDistance = VectorSubtract(VectorMultiplyAdd(R, InvSinH, VectorMultiply(Lateral, InvTanH)), Depth);
+        const VectorRegister4Float VerticalDistance = VectorSubtract(VectorMultiplyAdd(R, InvSinV, VectorMultiply(Vertical, InvTanV)), Depth);
+        MaxDistance = VectorMax(MaxDistance, VectorMax(HorizontalDistance, VerticalDistance));
+    }
+
+    const float MinDistanceSetting = FMath::Max(Settings.MinDistance, 0.0f);
+    const float MaxDistanceSetting = FMath::Max(Settings.MaxDistance, MinDistanceSetting);
+    const float RequiredDistance = HorizontalMax(MaxDistance);
+
+    OutSolution.Center = Origin + FVector(Center);
+    OutSolution.Radius = HorizontalMax(MaxRadius);
+    OutSolution.HalfWidth = HorizontalMax(MaxHalfWidth);
+    OutSolution.HalfHeight = HorizontalMax(MaxHalfHeight);
+    OutSolution.Distance = FMath::Clamp(RequiredDistance, MinDistanceSetting, MaxDistanceSetting);
+    OutSolution.FieldOfView = FieldOfView;
+
+    if (RequiredDistance <= MaxDistanceSetting)
+    {
+        return true;
+    }
+
+    // Pass 3, only when the distance is capped: the half angles that fit every sphere from there
+    const VectorRegister4Float CappedDistance = VectorSetFloat1(OutSolution.Distance);
+    VectorRegister4Float MaxHalfAngleH = Zero;
+    VectorRegister4Float MaxHalfAngleV = Zero;
+    for (int32 Lane = 0; Lane < NumLanes; Lane += 4)
+    {
+        const VectorRegister4Float DX = VectorSubtract(VectorLoadAligned(&PointX[Lane]), VectorSetFloat1(Center.X));
+        const VectorRegister4Float DY = VectorSubtract(VectorLoadAligned(&PointY[Lane]), VectorSetFloat1(Center.Y));
+        const VectorRegister4Float DZ = VectorSubtract(VectorLoadAligned(&PointZ[Lane]), VectorSetFloat1(Center.Z));
+        const VectorRegister4Float R = VectorLoadAligned(&PointRadius[Lane]);
+
+        const VectorRegister4Float Depth = VectorAdd(CappedDistance, Dot3(DX, DY, DZ, Forward));
+        MaxHalfAngleH = VectorMax(MaxHalfAngleH, FittingHalfAngle(VectorAbs(Dot3(DX, DY, DZ, Right)), Depth, R));
+        MaxHalfAngleV = VectorMax(MaxHalfAngleV, FittingHalfAngle(VectorAbs(Dot3(DX, DY, DZ, Up)), Depth, R));
+    }
+
+    // Back to a horizontal FOV, widened again for the margin
+    const float MaxHalf = FMath::DegreesToRadians(89.0f);
+    const float TanNeededH = FMath::Tan(FMath::Min(HorizontalMax(MaxHalfAngleH), MaxHalf));
+    const float TanNeededV = FMath::Tan(FMath::Min(HorizontalMax(MaxHalfAngleV), MaxHalf)) * FMath::Max(AspectRatio, UE_KINDA_SMALL_NUMBER);
+    const float NeededFOV = FMath::RadiansToDegrees(2.0f * FMath::Atan(FMath::Max(TanNeededH, TanNeededV) / Usable));
+    OutSolution.FieldOfView = FMath::Clamp(NeededFOV, FieldOfView, FMath::Max(Settings.MaxFieldOfView, FieldOfView));
+    return true;
+}
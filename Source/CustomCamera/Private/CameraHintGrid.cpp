@@ -0,0 +1,141 @@
+#include "CameraHintGrid.h"
+#include "CameraHintVolume.h"
+#include "Components/BoxComponent.h"
+
+FCameraHintGrid::FCameraHintGrid(float InCellSize)
+    : CellSize(FMath::Max(InCellSize, 1.0f))
+    , InvCellSize(1.0f / FMath::Max(InCellSize, 1.0f))
+{
+}
+
+FIntVector FCameraHintGrid::ToCell(const FVector& Location) const
+{
+    return FIntVector(
+        FMath::FloorToInt(Location.X * InvCellSize),
+        FMath::FloorToInt(Location.Y * InvCellSize),
+        FMath::FloorToInt(Location.Z * InvCellSize));
+}
+
+void FCameraHintGrid::Add(const ACameraHintVolume* Volume)
+{
+    if (!Volume || !Volume->Bounds)
+    {
+        return;
+    }
+    Remove(Volume);
+
+    FEntry Entry;
+    Entry.Volume = Volume;
+    Entry.Transform = Volume->Bounds->GetComponentTransform();
+    Entry.Extent = Volume->Bounds->GetUnscaledBoxExtent();
+    Entry.Priority = Volume->Priority;
+
+    const FBox WorldBounds = FBox(-Entry.Extent, Entry.Extent).TransformBy(Entry.Transform);
+    Entry.MinCell = ToCell(WorldBounds.Min);
+    Entry.MaxCell = ToCell(WorldBounds.Max);
+
+    const FIntVector Size = Entry.MaxCell - Entry.MinCell + FIntVector(1);
+    Entry.bOversized = static_cast<int64>(Size.X) * Size.Y * Size.Z > MaxCellsPerVolume;
+
+    const int32 EntryIndex = Entries.Add(Entry);
+    EntryByVolume.Add(Volume, EntryIndex);
+
+    if (Entry.bOversized)
+    {
+        OversizedEntries.Add(EntryIndex);
+        return;
+    }
+
+    for (int32 X = Entry.MinCell.X; X <= Entry.MaxCell.X; ++X)
+    {
+        for (int32 Y = Entry.MinCell.Y; Y <= Entry.MaxCell.Y; ++Y)
+        {
+            for (int32 Z = Entry.MinCell.Z; Z <= Entry.MaxCell.Z; ++Z)
+            {
+                Cells.FindOrAdd(FIntVector(X, Y, Z)).Add(EntryIndex);
+            }
+        }
+    }
+}
+
+void FCameraHintGrid::Remove(const ACameraHintVolume* Volume)
+{
+    int32 EntryIndex = INDEX_NONE;
+    if (!EntryByVolume.RemoveAndCopyValue(Volume, EntryIndex))
+    {
+        return;
+    }
+
+    const FEntry& Entry = Entries[EntryIndex];
+    if (Entry.bOversized)
+    {
+        OversizedEntries.RemoveSingleSwap(EntryIndex, false);
+        Entries.RemoveAt(EntryIndex);
+        return;
+    }
+
+    for (int32 X = Entry.MinCell.X; X <= Entry.MaxCell.X; ++X)
+    {
+        for (int32 Y = Entry.MinCell.Y; Y <= Entry.MaxCell.Y; ++Y)
+        {
+            for (int32 Z = Entry.MinCell.Z; Z <= Entry.MaxCell.Z; ++Z)
+            {
+                const FIntVector Cell(X, Y, Z);
+                if (TArray<int32, TInlineAllocator<2>>* CellEntries = Cells.Find(Cell))
+                {
+                    CellEntries->RemoveSingleSwap(EntryIndex, false);
+                    if (CellEntries->Num() == 0)
+                    {
+                        Cells.Remove(Cell);
+                    }
+                }
+            }
+        }
+    }
+    Entries.RemoveAt(EntryIndex);
+}
+
+void FCameraHintGrid::Reset()
+{
+    Entries.Empty();
+    EntryByVolume.Empty();
+    Cells.Empty();
+    OversizedEntries.Empty();
+}
+
+const ACameraHintVolume* FCameraHintGrid::Find(const FVector& Location) const
+{
+    const ACameraHintVolume* Best = nullptr;
+    int32 BestPriority = MIN_int32;
+    if (const TArray<int32, TInlineAllocator<2>>* CellEntries = Cells.Find(ToCell(Location)))
+    {
+        for (const int32 EntryIndex : *CellEntries)
+        {
+            Consider(Entries[EntryIndex], Location, Best, BestPriority);
+        }
+    }
+
+    for (const int32 EntryIndex : OversizedEntries)
+    {
+        Consider(Entries[EntryIndex], Location, Best, BestPriority);
+    }
+    return Best;
+}
+
+void FCameraHintGrid::Consider(const FEntry& Entry, const FVector& Location, const ACameraHintVolume*& Best, int32& BestPriority)
+{
+    if (Entry.Priority < BestPriority || (Best && Entry.Priority == BestPriority))
+    {
+        return;
+    }
+
+    const FVector Local = Entry.Transform.InverseTransformPosition(Location);
+    if (FMath::Abs(Local.X) <= Entry.Extent.X && FMath::Abs(Local.Y) <= Entry.Extent.Y && FMath::Abs(Local.Z) <= Entry.Extent.Z)
+    {
+        if (const ACameraHintVolume* Volume = Entry.Volume.Get())
+        {
+            Best = Volume;
+            BestPriority = Entry.Priority;
+        }
+    }
+}
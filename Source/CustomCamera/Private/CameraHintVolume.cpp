@@ -0,0 +1,46 @@
+#include "CameraHintVolume.h"
+#include "Components/BoxComponent.h"
+#include "CustomCameraSubsystem.h"
+#include "Engine/World.h"
+
+ACameraHintVolume::ACameraHintVolume()
+{
+    PrimaryActorTick.bCanEverTick = false;
+
+    Bounds = CreateDefaultSubobject<UBoxComponent>(TEXT("Bounds"));
+    Bounds->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    Bounds->SetBoxExtent(FVector(500.0f, 500.0f, 200.0f));
+    Bounds->SetHiddenInGame(true);
+    RootComponent = Bounds;
+
+    Priority = 0;
+}
+
+void ACameraHintVolume::BeginPlay()
+{
+    Super::BeginPlay();
+    UpdateRegistration();
+}
+
+void ACameraHintVolume::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (UCustomCameraSubsystem* Subsystem = World->GetSubsystem<UCustomCameraSubsystem>())
+        {
+            Subsystem->UnregisterCameraHint(this);
+        }
+    }
+    Super::EndPlay(EndPlayReason);
+}
+
+void ACameraHintVolume::UpdateRegistration()
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (UCustomCameraSubsystem* Subsystem = World->GetSubsystem<UCustomCameraSubsystem>())
+        {
+            Subsystem->RegisterCameraHint(this);
+        }
+    }
+}
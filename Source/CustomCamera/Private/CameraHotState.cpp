@@ -0,0 +1,170 @@
+#include "CameraHotState.h"
+#include "CameraSpring.h"
+
+FCameraHotStepOutput FCameraHotStepOutput::Lerp(const FCameraHotStepOutput& A, const FCameraHotStepOutput& B, float Alpha)
+{
+    FCameraHotStepOutput Result;
+    Result.FieldOfView = FMath::Lerp(A.FieldOfView, B.FieldOfView, Alpha);
+    Result.ShoulderOffset = FMath::Lerp(A.ShoulderOffset, B.ShoulderOffset, Alpha);
+    Result.OscillationOffset = FMath::Lerp(A.OscillationOffset, B.OscillationOffset, Alpha);
+    Result.Rotation = FMath::Lerp(A.Rotation, B.Rotation, Alpha);
+    Result.RecoilRotation = FMath::Lerp(A.RecoilRotation, B.RecoilRotation, Alpha);
+    return Result;
+}
+
+void FCameraHotStateArrays::SetNum(int32 NewNum)
+{
+    const bool bAllowShrinking = false;
+    Settings.SetNum(NewNum, bAllowShrinking);
+    Features.SetNum(NewNum, bAllowShrinking);
+    DeltaTime.SetNum(NewNum, bAllowShrinking);
+    Speed.SetNum(NewNum, bAllowShrinking);
+    bIsAiming.SetNum(NewNum, bAllowShrinking);
+    bIsRunning.SetNum(NewNum, bAllowShrinking);
+    LookRotation.SetNum(NewNum, bAllowShrinking);
+
+    FieldOfView.SetNum(NewNum, bAllowShrinking);
+    BobPhase.SetNum(NewNum, bAllowShrinking);
+    SwayPhase.SetNum(NewNum, bAllowShrinking);
+    ShoulderOffset.SetNum(NewNum, bAllowShrinking);
+    InertiaRotation.SetNum(NewNum, bAllowShrinking);
+    RecoilRotation.SetNum(NewNum, bAllowShrinking);
+    Springs.SetNum(NewNum, bAllowShrinking);
+    StepAccumulator.SetNum(NewNum, bAllowShrinking);
+    PreviousStep.SetNum(NewNum, bAllowShrinking);
+
+    OscillationOffset.SetNum(NewNum, bAllowShrinking);
+    DesiredRotation.SetNum(NewNum, bAllowShrinking);
+    Output.SetNum(NewNum, bAllowShrinking);
+}
+
+void FCameraHotStateArrays::Evaluate(int32 Index)
+{
+    DispatchCameraFeatures(Features[Index], [this, Index](auto Enabled)
+    {
+        Evaluate(Index, Enabled);
+    });
+}
+
+template<typename TFeatures>
+void FCameraHotStateArrays::Evaluate(int32 Index, TFeatures Enabled)
+{
+    const float FixedStep = Settings[Index].FixedStep;
+    if (FixedStep <= 0.0f)
+    {
+        Step(Index, DeltaTime[Index], Enabled);
+        Output[Index] = CaptureStep(Index);
+        return;
+    }
+
+    float& Accumulator = StepAccumulator[Index];
+    Accumulator += DeltaTime[Index];
+
+    int32 NumSteps = 0;
+    while (Accumulator >= FixedStep && NumSteps < MaxStepsPerFrame)
+    {
+        PreviousStep[Index] = CaptureStep(Index);
+        Step(Index, FixedStep, Enabled);
+        Accumulator -= FixedStep;
+        ++NumSteps;
+    }
+    Accumulator = FMath::Min(Accumulator, FixedStep);
+
+    // Render between the last two steps; this lags the simulation by up to one step
+    Output[Index] = FCameraHotStepOutput::Lerp(PreviousStep[Index], CaptureStep(Index), Accumulator / FixedStep);
+
+    // Without inertia the view follows look input directly rather than a step behind it
+    if (!Enabled.Has(ECameraHotFeature::Inertia))
+    {
+        Output[Index].Rotation = LookRotation[Index];
+    }
+}
+
+FCameraHotStepOutput FCameraHotStateArrays::CaptureStep(int32 Index) const
+{
+    FCameraHotStepOutput Result;
+    Result.FieldOfView = FieldOfView[Index];
+    Result.ShoulderOffset = ShoulderOffset[Index];
+    Result.OscillationOffset = OscillationOffset[Index];
+    Result.Rotation = DesiredRotation[Index];
+    Result.RecoilRotation = RecoilRotation[Index];
+    return Result;
+}
+
+template<typename TFeatures>
+void FCameraHotStateArrays::Step(int32 Index, float Dt, TFeatures Enabled)
+{
+    const FCameraHotSettings& S = Settings[Index];
+    FCameraHotSprings& Spring = Springs[Index];
+
+    // 2. FOV arbitration, starting from the base FOV the mode stack left; the last enabled feature picks the goal
+    constexpr ECameraHotFeature FOVFeatures = ECameraHotFeature::DynamicFOV | ECameraHotFeature::DynamicZoom | ECameraHotFeature::FocusFOV;
+    if (Enabled.Has(FOVFeatures))
+    {
+        float GoalFOV = S.DefaultFOV;
+        float FOVSpeed = 5.0f;
+        if (Enabled.Has(ECameraHotFeature::DynamicFOV))
+        {
+            if (bIsAiming[Index])
+            {
+                GoalFOV = S.AimingFOV;
+            }
+            else if (Speed[Index] > S.DynamicZoomThreshold)
+            {
+                GoalFOV = bIsRunning[Index] ? S.SprintFOV : S.ZoomedFOV;
+            }
+        }
+
+        if (Enabled.Has(ECameraHotFeature::DynamicZoom))
+        {
+            GoalFOV = Speed[Index] > S.DynamicZoomThreshold ? S.ZoomedFOV : S.DefaultFOV;
+            FOVSpeed = S.DynamicZoomSpeed;
+        }
+
+        if (Enabled.Has(ECameraHotFeature::FocusFOV))
+        {
+            GoalFOV = FMath::Clamp(S.FocusDistance / 10.0f, 60.0f, 90.0f);
+            FOVSpeed = 5.0f;
+        }
+
+        CameraSpring::CriticallyDamped(FieldOfView[Index], Spring.FieldOfView, GoalFOV, CameraSpring::HalfLifeFromSpeed(FOVSpeed), Dt);
+    }
+
+    // 3. Offsets
+    if (Enabled.Has(ECameraHotFeature::ShoulderOffset))
+    {
+        const FVector TargetOffset = bIsAiming[Index] ? S.OverShoulderOffset : FVector::ZeroVector;
+        CameraSpring::CriticallyDamped(ShoulderOffset[Index], Spring.ShoulderOffset, TargetOffset, CameraSpring::HalfLifeFromSpeed(S.RepositioningSpeed), Dt);
+    }
+
+    // Phases advance with delta time so frequency changes (walk/run) don't jump the offset
+    FVector Oscillation = FVector::ZeroVector;
+    if (Enabled.Has(ECameraHotFeature::HeadBob))
+    {
+        const bool bRunning = bIsRunning[Index];
+        BobPhase[Index] = FMath::Fmod(BobPhase[Index] + Dt * S.BobFrequency * (bRunning ? 1.5f : 1.0f), UE_TWO_PI);
+        Oscillation.Z = FMath::Sin(BobPhase[Index]) * (bRunning ? S.RunningBobMagnitude : S.WalkingBobMagnitude);
+    }
+
+    if (Enabled.Has(ECameraHotFeature::Sway))
+    {
+        SwayPhase[Index] = FMath::Fmod(SwayPhase[Index] + Dt * S.SwaySpeed, UE_TWO_PI);
+        Oscillation.X = FMath::Sin(SwayPhase[Index]) * S.SwayAmount;
+        Oscillation.Y = FMath::Cos(SwayPhase[Index]) * S.SwayAmount;
+    }
+    OscillationOffset[Index] = Oscillation;
+
+    // 5. Rotation
+    FRotator Rotation = LookRotation[Index];
+    if (Enabled.Has(ECameraHotFeature::Inertia))
+    {
+        CameraSpring::CriticallyDamped(InertiaRotation[Index], Spring.InertiaRotation, Rotation, CameraSpring::HalfLifeFromSpeed(S.InertiaStrength), Dt);
+        Rotation = InertiaRotation[Index];
+    }
+    DesiredRotation[Index] = Rotation;
+
+    if (Enabled.Has(ECameraHotFeature::Recoil) && !RecoilRotation[Index].IsZero())
+    {
+        CameraSpring::CriticallyDamped(RecoilRotation[Index], Spring.RecoilRotation, FRotator::ZeroRotator, CameraSpring::HalfLifeFromSpeed(S.RecoilRecoverySpeed), Dt);
+    }
+}
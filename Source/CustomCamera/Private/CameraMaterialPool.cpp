@@ -0,0 +1,47 @@
+#include "CameraMaterialPool.h"
+#include "Materials/MaterialInterface.h"
+#include "Materials/MaterialInstanceDynamic.h"
+
+UMaterialInstanceDynamic* FCameraMaterialInstancePool::Acquire(UMaterialInterface* Parent, UObject* Outer)
+{
+    if (!Parent)
+    {
+        return nullptr;
+    }
+
+    for (FPooledMaterialInstance& Entry : Entries)
+    {
+        if (!Entry.bInUse && Entry.Instance && Entry.Instance->Parent == Parent)
+        {
+            Entry.Instance->ClearParameterValues();
+            Entry.bInUse = true;
+            return Entry.Instance;
+        }
+    }
+
+    UMaterialInstanceDynamic* NewInstance = UMaterialInstanceDynamic::Create(Parent, Outer);
+    if (NewInstance)
+    {
+        FPooledMaterialInstance& Entry = Entries.AddDefaulted_GetRef();
+        Entry.Instance = NewInstance;
+        Entry.bInUse = true;
+    }
+    return NewInstance;
+}
+
+void FCameraMaterialInstancePool::Release(UMaterialInstanceDynamic* Instance)
+{
+    for (FPooledMaterialInstance& Entry : Entries)
+    {
+        if (Entry.Instance == Instance)
+        {
+            Entry.bInUse = false;
+            return;
+        }
+    }
+}
+
+void FCameraMaterialInstancePool::Empty()
+{
+    Entries.Empty();
+}
@@ -0,0 +1,146 @@
+#include "CameraModeStack.h"
+
+namespace CameraModes
+{
+    static FCameraPoseAccumulator EvaluateThirdPerson(const FCameraModeContext& Context)
+    {
+        return FCameraPoseAccumulator(Context.ThirdPersonLocation, Context.LookRotation, Context.DefaultFOV);
+    }
+
+    static FCameraPoseAccumulator EvaluateFirstPerson(const FCameraModeContext& Context)
+    {
+        return FCameraPoseAccumulator(Context.FirstPersonLocation, Context.LookRotation, Context.DefaultFOV);
+    }
+
+    static FCameraPoseAccumulator EvaluateFreeCamera(const FCameraModeContext& Context)
+    {
+        return FCameraPoseAccumulator(Context.FreeCameraLocation, Context.LookRotation, Context.DefaultFOV);
+    }
+
+    static FCameraPoseAccumulator EvaluateCinematic(const FCameraModeContext& Context)
+    {
+        return FCameraPoseAccumulator(Context.CinematicLocation, Context.CinematicRotation, Context.CinematicFOV);
+    }
+
+    using FEvaluator = FCameraPoseAccumulator (*)(const FCameraModeContext&);
+
+    // Indexed by ECameraMode
+    static const FEvaluator Evaluators[] =
+    {
+        &EvaluateThirdPerson,
+        &EvaluateFirstPerson,
+        &EvaluateFreeCamera,
+        &EvaluateCinematic,
+    };
+
+    FCameraPoseAccumulator Evaluate(ECameraMode Mode, const FCameraModeContext& Context)
+    {
+        const int32 ModeIndex = static_cast<int32>(Mode);
+        check(ModeIndex < UE_ARRAY_COUNT(Evaluators));
+        return Evaluators[ModeIndex](Context);
+    }
+}
+
+static FCameraPoseAccumulator EvaluateEntry(const FCameraModeStackEntry& Entry, const FCameraModeContext& Context)
+{
+    FCameraPoseAccumulator Pose = CameraModes::Evaluate(Entry.Mode, Context);
+    if (Entry.bOverrideAnchor)
+    {
+        Pose.Location = Entry.AnchorLocation;
+        Pose.FieldOfView = Entry.AnchorFOV;
+    }
+    return Pose;
+}
+
+void FCameraModeStack::Push(ECameraMode Mode, float BlendTime, EAlphaBlendOption BlendOption)
+{
+    // Already showing (or blending towards) this mode
+    if (Entries.Num() > 0 && Entries.Last().Mode == Mode && !Entries.Last().bOverrideAnchor)
+    {
+        return;
+    }
+
+    FCameraModeStackEntry Entry;
+    Entry.Mode = Mode;
+    Entry.BlendTime = BlendTime;
+    Entry.BlendOption = BlendOption;
+    PushEntry(Entry);
+}
+
+void FCameraModeStack::PushAnchored(ECameraMode Mode, const FVector& Location, float FOV, float BlendTime, EAlphaBlendOption BlendOption)
+{
+    FCameraModeStackEntry Entry;
+    Entry.Mode = Mode;
+    Entry.BlendTime = BlendTime;
+    Entry.BlendOption = BlendOption;
+    Entry.bOverrideAnchor = true;
+    Entry.AnchorLocation = Location;
+    Entry.AnchorFOV = FOV;
+    PushEntry(Entry);
+}
+
+void FCameraModeStack::PushEntry(const FCameraModeStackEntry& Entry)
+{
+    // The entries below keep evaluating, so the new mode blends in from the pose currently shown
+    if (Entries.Num() == MaxEntries)
+    {
+        Entries.RemoveAt(0, 1, false);
+    }
+
+    FCameraModeStackEntry& Added = Entries.Add_GetRef(Entry);
+    Added.Elapsed = 0.0f;
+    Added.Weight = (Entry.BlendTime > 0.0f && Entries.Num() > 1) ? 0.0f : 1.0f;
+}
+
+FCameraPoseAccumulator FCameraModeStack::Evaluate(const FCameraModeContext& Context, float DeltaTime)
+{
+    if (Entries.Num() == 0)
+    {
+        return FCameraPoseAccumulator(Context.ThirdPersonLocation, Context.LookRotation, Context.DefaultFOV);
+    }
+
+    int32 FirstVisible = 0;
+    for (int32 Index = 0; Index < Entries.Num(); ++Index)
+    {
+        FCameraModeStackEntry& Entry = Entries[Index];
+        if (Entry.Weight < 1.0f)
+        {
+            Entry.Elapsed += DeltaTime;
+            const float Alpha = Entry.BlendTime > 0.0f ? FMath::Clamp(Entry.Elapsed / Entry.BlendTime, 0.0f, 1.0f) : 1.0f;
+            Entry.Weight = Alpha < 1.0f ? FAlphaBlend::AlphaToBlendOption(Alpha, Entry.BlendOption) : 1.0f;
+        }
+
+        if (Entry.Weight >= 1.0f)
+        {
+            FirstVisible = Index;
+        }
+    }
+
+    // Everything under the topmost fully weighted entry contributes nothing
+    if (FirstVisible > 0)
+    {
+        Entries.RemoveAt(0, FirstVisible, false);
+    }
+
+    FCameraPoseAccumulator Pose = EvaluateEntry(Entries[0], Context);
+    for (int32 Index = 1; Index < Entries.Num(); ++Index)
+    {
+        const FCameraModeStackEntry& Entry = Entries[Index];
+        if (Entry.Weight <= 0.0f)
+        {
+            continue;
+        }
+
+        const FCameraPoseAccumulator EntryPose = EvaluateEntry(Entry, Context);
+        Pose.Location = FMath::Lerp(Pose.Location, EntryPose.Location, Entry.Weight);
+        // Towards the nearest equivalent rotation so a blend across +-180 yaw doesn't swing the long way round
+        Pose.Rotation = FMath::Lerp(Pose.Rotation, Pose.Rotation + (EntryPose.Rotation - Pose.Rotation).GetNormalized(), Entry.Weight).GetNormalized();
+        Pose.FieldOfView = FMath::Lerp(Pose.FieldOfView, EntryPose.FieldOfView, Entry.Weight);
+    }
+    return Pose;
+}
+
+void FCameraModeStack::Reset()
+{
+    Entries.Reset();
+}
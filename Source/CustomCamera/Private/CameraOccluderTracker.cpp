@@ -0,0 +1,150 @@
+#include "CameraOccluderTracker.h"
+#include "CameraQueryBatcher.h"
+#include "CameraOcclusionFader.h"
+#include "Components/PrimitiveComponent.h"
+
+void FCameraOccluderTracker::Configure(const FCameraOccluderTrackerSettings& InSettings)
+{
+    Settings = InSettings;
+    Settings.RaysPerTarget = FMath::Clamp(Settings.RaysPerTarget, 1, 8);
+    Settings.FadeInSamples = FMath::Clamp(Settings.FadeInSamples, 1, HistoryLength);
+    Settings.FadeOutSamples = FMath::Clamp(Settings.FadeOutSamples, 1, HistoryLength);
+    Settings.MaxTrackedOccluders = FMath::Max(Settings.MaxTrackedOccluders, 1);
+
+    FadeOutMask = static_cast<uint8>((1u << Settings.FadeOutSamples) - 1u);
+    Occluders.Reserve(Settings.MaxTrackedOccluders);
+}
+
+int32 FCameraOccluderTracker::GetNumProbes() const
+{
+    return Settings.bUseSphereSweep ? 1 : Settings.RaysPerTarget;
+}
+
+void FCameraOccluderTracker::RequestProbes(FCameraQueryBatcher& Batcher, const FVector& CameraLocation, const FVector& HeadLocation, const FVector& ChestLocation) const
+{
+    RequestTargetProbes(Batcher, CameraLocation, HeadLocation, 0);
+    RequestTargetProbes(Batcher, CameraLocation, ChestLocation, GetNumProbes());
+}
+
+void FCameraOccluderTracker::RequestTargetProbes(FCameraQueryBatcher& Batcher, const FVector& CameraLocation, const FVector& TargetLocation, int32 FirstIndex) const
+{
+    const FVector ToTarget = TargetLocation - CameraLocation;
+    const float Distance = ToTarget.Size();
+    if (Distance <= Settings.EndPadding)
+    {
+        return;
+    }
+
+    const FVector Direction = ToTarget / Distance;
+    const FVector End = CameraLocation + Direction * (Distance - Settings.EndPadding);
+
+    if (Settings.bUseSphereSweep)
+    {
+        Batcher.RequestSweep(ECameraProbe::Transparency, CameraLocation, End, FCollisionShape::MakeSphere(Settings.SweepRadius), ECC_Visibility, static_cast<uint8>(FirstIndex));
+        return;
+    }
+
+    // Centre ray plus the rest spread evenly on a ring around the camera-to-target axis
+    FVector AxisY, AxisZ;
+    Direction.FindBestAxisVectors(AxisY, AxisZ);
+
+    Batcher.RequestLineTrace(ECameraProbe::Transparency, CameraLocation, End, ECC_Visibility, static_cast<uint8>(FirstIndex));
+    const int32 RingRays = Settings.RaysPerTarget - 1;
+    for (int32 RayIndex = 0; RayIndex < RingRays; ++RayIndex)
+    {
+        const float Angle = (2.0f * PI * RayIndex) / RingRays;
+        const FVector Offset = (AxisY * FMath::Cos(Angle) + AxisZ * FMath::Sin(Angle)) * Settings.FanRadius;
+        Batcher.RequestLineTrace(ECameraProbe::Transparency, CameraLocation + Offset, End + Offset, ECC_Visibility, static_cast<uint8>(FirstIndex + RayIndex + 1));
+    }
+}
+
+void FCameraOccluderTracker::ConsumeResults(const FCameraQueryBatcher& Batcher, FCameraOcclusionFader& Fader)
+{
+    // Collect the distinct primitives hit by this sample
+    TArray<UPrimitiveComponent*, TInlineAllocator<16>> SampleHits;
+    bool bAnyResult = false;
+
+    const int32 NumProbes = GetNumProbes() * 2;
+    for (int32 ProbeIndex = 0; ProbeIndex < NumProbes; ++ProbeIndex)
+    {
+        const FCameraProbeResult* Result = Batcher.GetResult(ECameraProbe::Transparency, static_cast<uint8>(ProbeIndex));
+        if (!Result)
+        {
+            continue;
+        }
+
+        bAnyResult = true;
+        if (Result->bBlockingHit)
+        {
+            if (UPrimitiveComponent* HitComponent = Result->Hit.GetComponent())
+            {
+                SampleHits.AddUnique(HitComponent);
+            }
+        }
+    }
+
+    // No sample arrived this frame; keep the current history and fades
+    if (!bAnyResult)
+    {
+        return;
+    }
+
+    for (FTrackedOccluder& Occluder : Occluders)
+    {
+        Occluder.History = static_cast<uint8>(Occluder.History << 1);
+    }
+
+    for (UPrimitiveComponent* HitComponent : SampleHits)
+    {
+        FTrackedOccluder* Found = Occluders.FindByPredicate([HitComponent](const FTrackedOccluder& Occluder)
+            {
+                return Occluder.Component.Get() == HitComponent;
+            });
+
+        if (!Found)
+        {
+            if (Occluders.Num() >= Settings.MaxTrackedOccluders)
+            {
+                continue;
+            }
+            Found = &Occluders.AddDefaulted_GetRef();
+            Found->Component = HitComponent;
+        }
+        Found->History |= 1u;
+    }
+
+    Fader.ClearTargets();
+    for (int32 Index = Occluders.Num() - 1; Index >= 0; --Index)
+    {
+        FTrackedOccluder& Occluder = Occluders[Index];
+        UPrimitiveComponent* Component = Occluder.Component.Get();
+        if (!Component)
+        {
+            Occluders.RemoveAtSwap(Index, 1, false);
+            continue;
+        }
+
+        if (!Occluder.bFading && FMath::CountBits(Occluder.History) >= static_cast<uint64>(Settings.FadeInSamples))
+        {
+            Occluder.bFading = true;
+        }
+        else if (Occluder.bFading && (Occluder.History & FadeOutMask) == 0)
+        {
+            Occluder.bFading = false;
+        }
+
+        if (Occluder.bFading)
+        {
+            Fader.MarkOccluded(Component);
+        }
+        else if (Occluder.History == 0)
+        {
+            Occluders.RemoveAtSwap(Index, 1, false);
+        }
+    }
+}
+
+void FCameraOccluderTracker::Reset()
+{
+    Occluders.Reset();
+}
@@ -0,0 +1,82 @@
+#include "CameraOcclusionFader.h"
+#include "Components/PrimitiveComponent.h"
+
+void FCameraOcclusionFader::Configure(int32 InDataIndex, float InFadeInTime, float InFadeOutTime, float InMaxFade)
+{
+    DataIndex = FMath::Max(InDataIndex, 0);
+    FadeInRate = InFadeInTime > 0.0f ? 1.0f / InFadeInTime : BIG_NUMBER;
+    FadeOutRate = InFadeOutTime > 0.0f ? 1.0f / InFadeOutTime : BIG_NUMBER;
+    MaxFade = FMath::Clamp(InMaxFade, 0.0f, 1.0f);
+}
+
+void FCameraOcclusionFader::ClearTargets()
+{
+    for (FOccluderFadeState& State : Occluders)
+    {
+        State.TargetFade = 0.0f;
+    }
+}
+
+void FCameraOcclusionFader::MarkOccluded(UPrimitiveComponent* Component)
+{
+    if (!Component)
+    {
+        return;
+    }
+
+    for (FOccluderFadeState& State : Occluders)
+    {
+        if (State.Component.Get() == Component)
+        {
+            State.TargetFade = MaxFade;
+            return;
+        }
+    }
+
+    FOccluderFadeState& NewState = Occluders.AddDefaulted_GetRef();
+    NewState.Component = Component;
+    NewState.TargetFade = MaxFade;
+}
+
+void FCameraOcclusionFader::Update(float DeltaTime)
+{
+    for (int32 Index = Occluders.Num() - 1; Index >= 0; --Index)
+    {
+        FOccluderFadeState& State = Occluders[Index];
+        UPrimitiveComponent* Component = State.Component.Get();
+        if (!Component)
+        {
+            Occluders.RemoveAtSwap(Index, 1, false);
+            continue;
+        }
+
+        if (State.Fade != State.TargetFade)
+        {
+            const float Rate = State.TargetFade > State.Fade ? FadeInRate : FadeOutRate;
+            State.Fade = FMath::FInterpConstantTo(State.Fade, State.TargetFade, DeltaTime, Rate);
+            WriteFade(Component, State.Fade);
+        }
+
+        if (State.Fade <= 0.0f && State.TargetFade <= 0.0f)
+        {
+            Occluders.RemoveAtSwap(Index, 1, false);
+        }
+    }
+}
+
+void FCameraOcclusionFader::ReleaseAll()
+{
+    for (const FOccluderFadeState& State : Occluders)
+    {
+        if (UPrimitiveComponent* Component = State.Component.Get())
+        {
+            WriteFade(Component, 0.0f);
+        }
+    }
+    Occluders.Reset();
+}
+
+void FCameraOcclusionFader::WriteFade(UPrimitiveComponent* Component, float Fade) const
+{
+    Component->SetCustomPrimitiveDataFloat(DataIndex, Fade);
+}
@@ -0,0 +1,138 @@
+#include "CameraPoseRecorder.h"
+
+void FCameraPoseRecorder::Initialize(float Seconds, float SampleRate)
+{
+    SampleRate = FMath::Max(SampleRate, 1.0f);
+    SampleInterval = 1.0f / SampleRate;
+
+    // One extra block: the block being overwritten can't be decoded any more
+    const int32 NumBlocks = FMath::DivideAndRoundUp(FMath::CeilToInt(FMath::Max(Seconds, 0.0f) * SampleRate), BlockSize) + 1;
+    Frames.SetNumZeroed(NumBlocks * BlockSize);
+    Keys.SetNumZeroed(NumBlocks);
+    Reset();
+}
+
+void FCameraPoseRecorder::Reset()
+{
+    NumWritten = 0;
+    TimeSinceSample = 0.0f;
+    EncodedLocation = FVector::ZeroVector;
+}
+
+void FCameraPoseRecorder::Record(float DeltaTime, const FCameraRecordedPose& Pose)
+{
+    if (!IsInitialized())
+    {
+        return;
+    }
+
+    if (NumWritten == 0)
+    {
+        WriteFrame(Pose);
+        return;
+    }
+
+    // Repeat the pose across a hitch so playback time stays true; capped so a long stall stays cheap
+    TimeSinceSample += DeltaTime;
+    for (int32 Written = 0; TimeSinceSample >= SampleInterval && Written < BlockSize; ++Written)
+    {
+        TimeSinceSample -= SampleInterval;
+        WriteFrame(Pose);
+    }
+    TimeSinceSample = FMath::Min(TimeSinceSample, SampleInterval);
+}
+
+void FCameraPoseRecorder::WriteFrame(const FCameraRecordedPose& Pose)
+{
+    const int32 Capacity = Frames.Num();
+    FFrame& Frame = Frames[NumWritten % Capacity];
+
+    if (NumWritten % BlockSize == 0)
+    {
+        Keys[(NumWritten / BlockSize) % Keys.Num()] = Pose.Location;
+        EncodedLocation = Pose.Location;
+    }
+
+    // Deltas are clamped; a teleport catches up over the following frames and at the next key
+    const FVector Delta = (Pose.Location - EncodedLocation) * PositionScale;
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        Frame.Delta[Axis] = static_cast<int16>(FMath::Clamp<int32>(FMath::RoundToInt(Delta[Axis]), MIN_int16, MAX_int16));
+        EncodedLocation[Axis] += Frame.Delta[Axis] / PositionScale;
+    }
+
+    Frame.Rotation[0] = FRotator::CompressAxisToShort(Pose.Rotation.Pitch);
+    Frame.Rotation[1] = FRotator::CompressAxisToShort(Pose.Rotation.Yaw);
+    Frame.Rotation[2] = FRotator::CompressAxisToShort(Pose.Rotation.Roll);
+    Frame.FieldOfView = static_cast<uint16>(FMath::Clamp<int32>(FMath::RoundToInt(Pose.FieldOfView * 64.0f), 0, MAX_uint16));
+
+    for (int32 Layer = 0; Layer < FCameraPostProcessStack::NumLayers; ++Layer)
+    {
+        Frame.LayerWeights[Layer] = static_cast<uint8>(FMath::RoundToInt(FMath::Clamp(Pose.LayerWeights[Layer], 0.0f, 1.0f) * 255.0f));
+    }
+
+    ++NumWritten;
+}
+
+int64 FCameraPoseRecorder::GetFirstSerial() const
+{
+    // Oldest block whose key hasn't been replaced by a newer block
+    const int64 NewestBlock = (NumWritten - 1) / BlockSize;
+    return FMath::Max<int64>(0, (NewestBlock - Keys.Num() + 1) * BlockSize);
+}
+
+void FCameraPoseRecorder::DecodeFrame(int64 Serial, FCameraRecordedPose& OutPose) const
+{
+    const int32 Capacity = Frames.Num();
+    const int64 BlockStart = Serial - Serial % BlockSize;
+
+    FVector Location = Keys[(Serial / BlockSize) % Keys.Num()];
+    for (int64 Index = BlockStart + 1; Index <= Serial; ++Index)
+    {
+        const FFrame& Step = Frames[Index % Capacity];
+        Location += FVector(Step.Delta[0], Step.Delta[1], Step.Delta[2]) / PositionScale;
+    }
+
+    const FFrame& Frame = Frames[Serial % Capacity];
+    OutPose.Location = Location;
+    OutPose.Rotation = FRotator(
+        FRotator::DecompressAxisFromShort(Frame.Rotation[0]),
+        FRotator::DecompressAxisFromShort(Frame.Rotation[1]),
+        FRotator::DecompressAxisFromShort(Frame.Rotation[2]));
+    OutPose.FieldOfView = Frame.FieldOfView / 64.0f;
+
+    for (int32 Layer = 0; Layer < FCameraPostProcessStack::NumLayers; ++Layer)
+    {
+        OutPose.LayerWeights[Layer] = Frame.LayerWeights[Layer] / 255.0f;
+    }
+}
+
+bool FCameraPoseRecorder::Sample(double Serial, FCameraRecordedPose& OutPose) const
+{
+    if (NumWritten == 0)
+    {
+        return false;
+    }
+
+    Serial = FMath::Clamp(Serial, static_cast<double>(GetFirstSerial()), static_cast<double>(NumWritten - 1));
+    const int64 From = FMath::FloorToInt64(Serial);
+    const int64 To = FMath::Min(From + 1, NumWritten - 1);
+    const float Alpha = static_cast<float>(Serial - From);
+
+    DecodeFrame(From, OutPose);
+    if (To == From || Alpha <= 0.0f)
+    {
+        return true;
+    }
+
+    FCameraRecordedPose Next;
+    DecodeFrame(To, Next);
+    OutPose.Location = FMath::Lerp(OutPose.Location, Next.Location, Alpha);
+    OutPose.Rotation = FMath::Lerp(OutPose.Rotation, Next.Rotation, Alpha);
+    OutPose.FieldOfView = FMath::Lerp(OutPose.FieldOfView, Next.FieldOfView, Alpha);
+    for (int32 Layer = 0; Layer < FCameraPostProcessStack::NumLayers; ++Layer)
+    {
+        OutPose.LayerWeights[Layer] = FMath::Lerp(OutPose.LayerWeights[Layer], Next.LayerWeights[Layer], Alpha);
+    }
+    return true;
+}
@@ -0,0 +1,169 @@
+#include "CameraPostProcessStack.h"
+#include "Engine/Scene.h"
+#include "Materials/MaterialInterface.h"
+
+void FCameraPostProcessStack::SetLayerWeight(ECameraPostProcessLayer Layer, float Weight)
+{
+    FLayer& Target = Layers[static_cast<int32>(Layer)];
+    Weight = FMath::Clamp(Weight, 0.0f, 1.0f);
+    if (Target.Weight != Weight)
+    {
+        Target.Weight = Weight;
+        bDirty = true;
+    }
+}
+
+float FCameraPostProcessStack::GetLayerWeight(ECameraPostProcessLayer Layer) const
+{
+    return Layers[static_cast<int32>(Layer)].Weight;
+}
+
+void FCameraPostProcessStack::SetField(ECameraPostProcessLayer Layer, ECameraPostProcessField Field, float Value)
+{
+    FLayer& Target = Layers[static_cast<int32>(Layer)];
+    const int32 FieldIndex = static_cast<int32>(Field);
+    const uint32 FieldBit = 1u << FieldIndex;
+    if (!(Target.FieldMask & FieldBit) || Target.Values[FieldIndex] != Value)
+    {
+        Target.FieldMask |= FieldBit;
+        Target.Values[FieldIndex] = Value;
+        bDirty = true;
+    }
+}
+
+void FCameraPostProcessStack::ClearField(ECameraPostProcessLayer Layer, ECameraPostProcessField Field)
+{
+    FLayer& Target = Layers[static_cast<int32>(Layer)];
+    const uint32 FieldBit = 1u << static_cast<uint32>(Field);
+    if (Target.FieldMask & FieldBit)
+    {
+        Target.FieldMask &= ~FieldBit;
+        bDirty = true;
+    }
+}
+
+void FCameraPostProcessStack::SetBlendable(ECameraPostProcessLayer Layer, UMaterialInterface* Material)
+{
+    FLayer& Target = Layers[static_cast<int32>(Layer)];
+    if (Target.Blendable.Get() != Material)
+    {
+        Target.Blendable = Material;
+        bDirty = true;
+    }
+}
+
+bool FCameraPostProcessStack::Push(FPostProcessSettings& Settings)
+{
+    if (!bDirty)
+    {
+        return false;
+    }
+    bDirty = false;
+
+    // Resolve fields: the first contributing layer sets the value, later layers blend over it by weight
+    uint32 ResolvedMask = 0;
+    float ResolvedValues[NumFields] = {};
+    for (const FLayer& Layer : Layers)
+    {
+        if (Layer.Weight <= 0.0f || Layer.FieldMask == 0)
+        {
+            continue;
+        }
+
+        for (int32 FieldIndex = 0; FieldIndex < NumFields; ++FieldIndex)
+        {
+            const uint32 FieldBit = 1u << FieldIndex;
+            if (!(Layer.FieldMask & FieldBit))
+            {
+                continue;
+            }
+
+            ResolvedValues[FieldIndex] = (ResolvedMask & FieldBit)
+                ? FMath::Lerp(ResolvedValues[FieldIndex], Layer.Values[FieldIndex], Layer.Weight)
+                : Layer.Values[FieldIndex];
+            ResolvedMask |= FieldBit;
+        }
+    }
+
+    bool bWrote = false;
+    for (int32 FieldIndex = 0; FieldIndex < NumFields; ++FieldIndex)
+    {
+        const uint32 FieldBit = 1u << FieldIndex;
+        const bool bSet = (ResolvedMask & FieldBit) != 0;
+        const bool bWasSet = (PushedMask & FieldBit) != 0;
+        if (bSet != bWasSet || (bSet && ResolvedValues[FieldIndex] != PushedValues[FieldIndex]))
+        {
+            WriteField(Settings, static_cast<ECameraPostProcessField>(FieldIndex), bSet, ResolvedValues[FieldIndex]);
+            PushedValues[FieldIndex] = ResolvedValues[FieldIndex];
+            bWrote = true;
+        }
+    }
+    PushedMask = ResolvedMask;
+
+    for (int32 LayerIndex = 0; LayerIndex < NumLayers; ++LayerIndex)
+    {
+        UMaterialInterface* Desired = Layers[LayerIndex].Blendable.Get();
+        const float DesiredWeight = Desired ? Layers[LayerIndex].Weight : 0.0f;
+        UMaterialInterface* Pushed = PushedBlendables[LayerIndex].Get();
+
+        if (Pushed != Desired && Pushed)
+        {
+            Settings.RemoveBlendable(Pushed);
+            bWrote = true;
+        }
+
+        if (Desired && (Pushed != Desired || PushedBlendableWeights[LayerIndex] != DesiredWeight))
+        {
+            // AddBlendable updates the weight in place when the material is already present
+            Settings.AddBlendable(Desired, DesiredWeight);
+            bWrote = true;
+        }
+
+        PushedBlendables[LayerIndex] = Desired;
+        PushedBlendableWeights[LayerIndex] = DesiredWeight;
+    }
+
+    return bWrote;
+}
+
+void FCameraPostProcessStack::Reset()
+{
+    for (FLayer& Layer : Layers)
+    {
+        Layer = FLayer();
+    }
+    bDirty = true;
+}
+
+void FCameraPostProcessStack::WriteField(FPostProcessSettings& Settings, ECameraPostProcessField Field, bool bOverride, float Value)
+{
+    switch (Field)
+    {
+    case ECameraPostProcessField::DepthOfFieldFocalDistance:
+        Settings.bOverride_DepthOfFieldFocalDistance = bOverride;
+        Settings.DepthOfFieldFocalDistance = Value;
+        break;
+    case ECameraPostProcessField::DepthOfFieldFocalRegion:
+        Settings.bOverride_DepthOfFieldFocalRegion = bOverride;
+        Settings.DepthOfFieldFocalRegion = Value;
+        break;
+    case ECameraPostProcessField::DepthOfFieldFstop:
+        Settings.bOverride_DepthOfFieldFstop = bOverride;
+        Settings.DepthOfFieldFstop = Value;
+        break;
+    case ECameraPostProcessField::MotionBlurAmount:
+        Settings.bOverride_MotionBlurAmount = bOverride;
+        Settings.MotionBlurAmount = Value;
+        break;
+    case ECameraPostProcessField::VignetteIntensity:
+        Settings.bOverride_VignetteIntensity = bOverride;
+        Settings.VignetteIntensity = Value;
+        break;
+    case ECameraPostProcessField::ColorGradingIntensity:
+        Settings.bOverride_ColorGradingIntensity = bOverride;
+        Settings.ColorGradingIntensity = Value;
+        break;
+    default:
+        break;
+    }
+}
@@ -0,0 +1,90 @@
+#include "CameraProbeCache.h"
+#include "Components/PrimitiveComponent.h"
+
+void FCameraProbeCache::Configure(float InLocationEpsilon, float InAngleEpsilonDegrees, float InMaxAge, float InMissMaxAge)
+{
+    LocationEpsilonSquared = FMath::Square(FMath::Max(InLocationEpsilon, 0.0f));
+    MinDirectionDot = FMath::Cos(FMath::DegreesToRadians(FMath::Max(InAngleEpsilonDegrees, 0.0f)));
+    MaxAge = InMaxAge;
+    MissMaxAge = FMath::Max(InMissMaxAge, 0.0f);
+}
+
+bool FCameraProbeCache::TryGet(const FVector& Start, const FVector& Direction, const FVector& OwnerLocation, float WorldTime, FHitResult& OutHit, bool& bOutBlockingHit) const
+{
+    if (!bValid)
+    {
+        return false;
+    }
+
+    if (MaxAge > 0.0f && WorldTime - CachedTime > MaxAge)
+    {
+        return false;
+    }
+
+    // A miss can't notice a door or vehicle moving into the path, so it is only trusted briefly
+    if (!bCachedBlockingHit && WorldTime - CachedTime > MissMaxAge)
+    {
+        return false;
+    }
+
+    if (FVector::DistSquared(Start, CachedStart) > LocationEpsilonSquared
+        || FVector::DistSquared(OwnerLocation, CachedOwnerLocation) > LocationEpsilonSquared
+        || FVector::DotProduct(Direction, CachedDirection) < MinDirectionDot)
+    {
+        return false;
+    }
+
+    if (HasTrackedPrimitiveMoved())
+    {
+        return false;
+    }
+
+    OutHit = CachedHit;
+    bOutBlockingHit = bCachedBlockingHit;
+    return true;
+}
+
+void FCameraProbeCache::Store(const FVector& Start, const FVector& Direction, const FVector& OwnerLocation, float WorldTime, const FHitResult& Hit, bool bBlockingHit)
+{
+    bValid = true;
+    CachedStart = Start;
+    CachedDirection = Direction;
+    CachedOwnerLocation = OwnerLocation;
+    CachedTime = WorldTime;
+    CachedHit = Hit;
+    bCachedBlockingHit = bBlockingHit;
+
+    // Static geometry can't invalidate the result; only track primitives that are able to move
+    TrackedPrimitives.Reset();
+    UPrimitiveComponent* HitComponent = Hit.GetComponent();
+    if (bBlockingHit && HitComponent && HitComponent->Mobility == EComponentMobility::Movable)
+    {
+        TrackedPrimitives.Add({ HitComponent, HitComponent->GetComponentTransform() });
+    }
+}
+
+void FCameraProbeCache::Invalidate()
+{
+    bValid = false;
+    TrackedPrimitives.Reset();
+}
+
+bool FCameraProbeCache::HasTrackedPrimitiveMoved() const
+{
+    for (const FTrackedPrimitive& Tracked : TrackedPrimitives)
+    {
+        const UPrimitiveComponent* Component = Tracked.Component.Get();
+        if (!Component)
+        {
+            return true;
+        }
+
+        const FTransform& Current = Component->GetComponentTransform();
+        if (FVector::DistSquared(Current.GetLocation(), Tracked.Transform.GetLocation()) > LocationEpsilonSquared
+            || !Current.GetRotation().Equals(Tracked.Transform.GetRotation(), KINDA_SMALL_NUMBER))
+        {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,127 @@
+#include "CameraQueryBatcher.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+void FCameraQueryBatcher::Initialize(AActor* IgnoredActor)
+{
+    QueryParams = FCollisionQueryParams(SCENE_QUERY_STAT(CustomCameraProbe), false);
+    if (IgnoredActor)
+    {
+        QueryParams.AddIgnoredActor(IgnoredActor);
+    }
+    Reset();
+}
+
+void FCameraQueryBatcher::BeginFrame(UWorld* World)
+{
+    for (FCameraProbeResult& Result : Results)
+    {
+        Result.bReady = false;
+    }
+
+    if (!World)
+    {
+        InFlightQueries.Reset();
+        return;
+    }
+
+    // The async trace buffers swap every frame, so a result missing now will never arrive
+    for (const FInFlightQuery& Query : InFlightQueries)
+    {
+        FTraceDatum Datum;
+        if (!World->QueryTraceData(Query.Handle, Datum))
+        {
+            ++NumDroppedQueries;
+            continue;
+        }
+
+        FCameraProbeResult& Result = FindOrAddResult(Query.Probe, Query.Index);
+        Result.bReady = true;
+        Result.bBlockingHit = Datum.OutHits.Num() > 0 && Datum.OutHits[0].bBlockingHit;
+        // A miss carries no hit, but consumers still key caches on the path that was traced
+        Result.Hit = Datum.OutHits.Num() > 0 ? Datum.OutHits[0] : FHitResult(Datum.Start, Datum.End);
+    }
+    InFlightQueries.Reset();
+}
+
+void FCameraQueryBatcher::Flush(UWorld* World)
+{
+    if (!World)
+    {
+        PendingQueries.Reset();
+        return;
+    }
+
+    for (const FPendingQuery& Query : PendingQueries)
+    {
+        FTraceHandle Handle;
+        if (Query.bSweep)
+        {
+            Handle = World->AsyncSweepByChannel(EAsyncTraceType::Single, Query.Start, Query.End, FQuat::Identity, Query.Channel, Query.Shape, QueryParams);
+        }
+        else
+        {
+            Handle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Query.Start, Query.End, Query.Channel, QueryParams);
+        }
+        InFlightQueries.Add({ Query.Probe, Query.Index, Handle });
+    }
+    PendingQueries.Reset();
+}
+
+void FCameraQueryBatcher::RequestLineTrace(ECameraProbe Probe, const FVector& Start, const FVector& End, ECollisionChannel Channel, uint8 Index)
+{
+    PendingQueries.Add({ Probe, Index, Start, End, FCollisionShape(), Channel, false });
+}
+
+void FCameraQueryBatcher::RequestSweep(ECameraProbe Probe, const FVector& Start, const FVector& End, const FCollisionShape& Shape, ECollisionChannel Channel, uint8 Index)
+{
+    PendingQueries.Add({ Probe, Index, Start, End, Shape, Channel, true });
+}
+
+bool FCameraQueryBatcher::TraceSync(UWorld* World, ECameraProbe Probe, const FVector& Start, const FVector& End, ECollisionChannel Channel, FHitResult& OutHit, uint8 Index)
+{
+    OutHit = FHitResult(Start, End);
+    const bool bHit = World && World->LineTraceSingleByChannel(OutHit, Start, End, Channel, QueryParams);
+
+    FCameraProbeResult& Result = FindOrAddResult(Probe, Index);
+    Result.bReady = true;
+    Result.bBlockingHit = bHit;
+    Result.Hit = OutHit;
+    return bHit;
+}
+
+const FCameraProbeResult* FCameraQueryBatcher::GetResult(ECameraProbe Probe, uint8 Index) const
+{
+    for (const FCameraProbeResult& Result : Results)
+    {
+        if (Result.Probe == Probe && Result.Index == Index)
+        {
+            return Result.bReady ? &Result : nullptr;
+        }
+    }
+    return nullptr;
+}
+
+void FCameraQueryBatcher::Reset()
+{
+    PendingQueries.Reset();
+    InFlightQueries.Reset();
+    Results.Reset();
+    NumDroppedQueries = 0;
+}
+
+FCameraProbeResult& FCameraQueryBatcher::FindOrAddResult(ECameraProbe Probe, uint8 Index)
+{
+    for (FCameraProbeResult& Result : Results)
+    {
+        if (Result.Probe == Probe && Result.Index == Index)
+        {
+            return Result;
+        }
+    }
+
+    FCameraProbeResult& NewResult = Results.AddDefaulted_GetRef();
+    NewResult.Probe = Probe;
+    NewResult.Index = Index;
+    return NewResult;
+}
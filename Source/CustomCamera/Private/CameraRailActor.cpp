@@ -0,0 +1,37 @@
+#include "CameraRailActor.h"
+#include "Components/SplineComponent.h"
+#include "Curves/CurveFloat.h"
+
+ACameraRailActor::ACameraRailActor()
+{
+    PrimaryActorTick.bCanEverTick = false;
+
+    Path = CreateDefaultSubobject<USplineComponent>(TEXT("Path"));
+    RootComponent = Path;
+
+    LookAtPath = CreateDefaultSubobject<USplineComponent>(TEXT("LookAtPath"));
+    LookAtPath->SetupAttachment(Path);
+
+    bUseLookAtPath = false;
+    FOVCurve = nullptr;
+    DefaultFOV = 90.0f;
+    Speed = 300.0f;
+    SampleSpacing = 10.0f;
+}
+
+void ACameraRailActor::OnConstruction(const FTransform& Transform)
+{
+    Super::OnConstruction(Transform);
+    RebuildTable();
+}
+
+void ACameraRailActor::BeginPlay()
+{
+    Super::BeginPlay();
+    RebuildTable();
+}
+
+void ACameraRailActor::RebuildTable()
+{
+    Table.Build(*Path, bUseLookAtPath ? LookAtPath : nullptr, FOVCurve, DefaultFOV, SampleSpacing);
+}
@@ -0,0 +1,87 @@
+#include "CameraRailTable.h"
+#include "Components/SplineComponent.h"
+#include "Curves/CurveFloat.h"
+
+void FCameraRailTable::Build(const USplineComponent& Path, const USplineComponent* LookAtPath, const UCurveFloat* FOVCurve, float DefaultFOV, float SampleSpacing)
+{
+    Reset();
+
+    Length = Path.GetSplineLength();
+    bClosedLoop = Path.IsClosedLoop();
+    if (Length <= KINDA_SMALL_NUMBER)
+    {
+        return;
+    }
+
+    // Round the spacing so the last sample lands exactly on the end of the rail
+    const int32 NumSamples = FMath::Max(FMath::CeilToInt(Length / FMath::Max(SampleSpacing, 1.0f)), 1) + 1;
+    InvSpacing = (NumSamples - 1) / Length;
+
+    Locations.SetNumUninitialized(NumSamples);
+    Rotations.SetNumUninitialized(NumSamples);
+    FieldsOfView.SetNumUninitialized(NumSamples);
+
+    const float LookAtLength = LookAtPath ? LookAtPath->GetSplineLength() : 0.0f;
+    for (int32 Index = 0; Index < NumSamples; ++Index)
+    {
+        // Baking is the only place the spline's own distance search runs
+        const float Alpha = static_cast<float>(Index) / (NumSamples - 1);
+        const float Distance = Alpha * Length;
+        const FVector Location = Path.GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+
+        FVector LookDirection = Path.GetDirectionAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+        if (LookAtPath)
+        {
+            const FVector ToLookAt = LookAtPath->GetLocationAtDistanceAlongSpline(Alpha * LookAtLength, ESplineCoordinateSpace::World) - Location;
+            if (!ToLookAt.IsNearlyZero())
+            {
+                LookDirection = ToLookAt;
+            }
+        }
+
+        Locations[Index] = Location;
+        Rotations[Index] = FRotationMatrix::MakeFromX(LookDirection).ToQuat();
+        FieldsOfView[Index] = FOVCurve ? FOVCurve->GetFloatValue(Alpha) : DefaultFOV;
+    }
+}
+
+FCameraRailSample FCameraRailTable::Sample(float Distance) const
+{
+    FCameraRailSample Result;
+    if (!IsValid())
+    {
+        return Result;
+    }
+
+    if (bClosedLoop)
+    {
+        Distance = FMath::Fmod(Distance, Length);
+        if (Distance < 0.0f)
+        {
+            Distance += Length;
+        }
+    }
+    else
+    {
+        Distance = FMath::Clamp(Distance, 0.0f, Length);
+    }
+
+    const float Position = Distance * InvSpacing;
+    const int32 Index = FMath::Min(FMath::FloorToInt(Position), Locations.Num() - 2);
+    const float Alpha = Position - Index;
+
+    Result.Location = FMath::Lerp(Locations[Index], Locations[Index + 1], Alpha);
+    Result.Rotation = FQuat::Slerp(Rotations[Index], Rotations[Index + 1], Alpha).Rotator();
+    Result.FieldOfView = FMath::Lerp(FieldsOfView[Index], FieldsOfView[Index + 1], Alpha);
+    return Result;
+}
+
+void FCameraRailTable::Reset()
+{
+    Locations.Reset();
+    Rotations.Reset();
+    FieldsOfView.Reset();
+    Length = 0.0f;
+    InvSpacing = 0.0f;
+    bClosedLoop = false;
+}
@@ -0,0 +1,168 @@
+#include "CameraShakeBank.h"
+#include "Math/VectorRegister.h"
+
+namespace
+{
+    // Gradient in [-1, 1] per lattice point, from the usual sine hash
+    FORCEINLINE VectorRegister4Float LatticeGradient(const VectorRegister4Float& Cell)
+    {
+        const VectorRegister4Float Hashed = VectorFractional(VectorMultiply(VectorSin(VectorMultiply(Cell, VectorSetFloat1(12.9898f))), VectorSetFloat1(43758.5453f)));
+        return VectorMultiplyAdd(Hashed, VectorSetFloat1(2.0f), VectorSetFloat1(-1.0f));
+    }
+
+    // 1D gradient (Perlin) noise for four lanes, roughly in [-1, 1]
+    FORCEINLINE VectorRegister4Float VectorPerlinNoise1D(const VectorRegister4Float& X)
+    {
+        const VectorRegister4Float One = VectorSetFloat1(1.0f);
+        const VectorRegister4Float Cell = VectorFloor(X);
+        const VectorRegister4Float T = VectorSubtract(X, Cell);
+
+        const VectorRegister4Float D0 = VectorMultiply(LatticeGradient(Cell), T);
+        const VectorRegister4Float D1 = VectorMultiply(LatticeGradient(VectorAdd(Cell, One)), VectorSubtract(T, One));
+
+        // Quintic fade: T^3 * (T * (6T - 15) + 10)
+        const VectorRegister4Float Inner = VectorMultiplyAdd(T, VectorMultiplyAdd(T, VectorSetFloat1(6.0f), VectorSetFloat1(-15.0f)), VectorSetFloat1(10.0f));
+        const VectorRegister4Float Fade = VectorMultiply(VectorMultiply(VectorMultiply(T, T), T), Inner);
+
+        return VectorMultiply(VectorMultiplyAdd(VectorSubtract(D1, D0), Fade, D0), VectorSetFloat1(2.0f));
+    }
+
+    FORCEINLINE float HorizontalSum(const VectorRegister4Float& Value)
+    {
+        alignas(16) float Lanes[4];
+        VectorStoreAligned(Value, Lanes);
+        return Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3];
+    }
+}
+
+FCameraShakeBank::FCameraShakeBank()
+    : ActiveMask(0)
+    , SeedStream(0x4B52594F)
+{
+    static_assert(Capacity % 4 == 0 && Capacity <= 32, "Shake lanes are evaluated four at a time and tracked in a uint32 mask");
+    StopAll();
+    FMemory::Memzero(AxisSeed);
+    FMemory::Memzero(bHasActionParams);
+}
+
+void FCameraShakeBank::BuildActionTable(const TArray<FCameraShakeMapping>& Mappings)
+{
+    FMemory::Memzero(bHasActionParams);
+    for (const FCameraShakeMapping& Mapping : Mappings)
+    {
+        const int32 ActionIndex = static_cast<int32>(Mapping.Action);
+        if (Mapping.Action != ECameraShakeAction::None && ActionIndex < NumActions)
+        {
+            ActionParams[ActionIndex] = Mapping.ShakeParams;
+            bHasActionParams[ActionIndex] = true;
+        }
+    }
+}
+
+bool FCameraShakeBank::PlayAction(ECameraShakeAction Action, float Scale)
+{
+    const int32 ActionIndex = static_cast<int32>(Action);
+    if (ActionIndex >= NumActions || !bHasActionParams[ActionIndex])
+    {
+        return false;
+    }
+
+    Play(ActionParams[ActionIndex], Scale);
+    return true;
+}
+
+void FCameraShakeBank::Play(const FCameraShakeParams& Params, float Scale)
+{
+    if (!Params.bAdditive)
+    {
+        StopAll();
+    }
+
+    const int32 Lane = FindLane();
+    Amplitude[Lane] = Params.Intensity * Scale;
+    Frequency[Lane] = FMath::Max(Params.Frequency, 0.0f);
+    Elapsed[Lane] = 0.0f;
+    InvDuration[Lane] = 1.0f / FMath::Max(Params.Duration, 0.01f);
+    PerlinWeight[Lane] = Params.Waveform == ECameraShakeWaveform::Perlin ? 1.0f : 0.0f;
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        AxisSeed[Axis][Lane] = SeedStream.FRandRange(0.0f, 256.0f);
+    }
+    ActiveMask |= 1u << Lane;
+}
+
+FRotator FCameraShakeBank::Evaluate(float DeltaTime)
+{
+    const VectorRegister4Float Zero = VectorZeroFloat();
+    const VectorRegister4Float One = VectorSetFloat1(1.0f);
+    const VectorRegister4Float TwoPi = VectorSetFloat1(UE_TWO_PI);
+    const VectorRegister4Float Dt = VectorSetFloat1(DeltaTime);
+
+    VectorRegister4Float Sum[3] = { Zero, Zero, Zero };
+    for (int32 Lane = 0; Lane < Capacity; Lane += 4)
+    {
+        const VectorRegister4Float Time = VectorAdd(VectorLoadAligned(&Elapsed[Lane]), Dt);
+        VectorStoreAligned(Time, &Elapsed[Lane]);
+
+        // Quadratic decay over the shake's duration
+        const VectorRegister4Float Remaining = VectorMax(VectorSubtract(One, VectorMultiply(Time, VectorLoadAligned(&InvDuration[Lane]))), Zero);
+        const VectorRegister4Float Gain = VectorMultiply(VectorLoadAligned(&Amplitude[Lane]), VectorMultiply(Remaining, Remaining));
+
+        const VectorRegister4Float Cycles = VectorMultiply(Time, VectorLoadAligned(&Frequency[Lane]));
+        const VectorRegister4Float Perlin = VectorLoadAligned(&PerlinWeight[Lane]);
+
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            // Both waveforms are computed and blended by lane so the loop has no branches
+            const VectorRegister4Float X = VectorAdd(Cycles, VectorLoadAligned(&AxisSeed[Axis][Lane]));
+            const VectorRegister4Float Sine = VectorSin(VectorMultiply(X, TwoPi));
+            const VectorRegister4Float Wave = VectorMultiplyAdd(VectorSubtract(VectorPerlinNoise1D(X), Sine), Perlin, Sine);
+            Sum[Axis] = VectorMultiplyAdd(Wave, Gain, Sum[Axis]);
+        }
+    }
+
+    // Retire lanes that ran out
+    for (int32 Lane = 0; Lane < Capacity; ++Lane)
+    {
+        if ((ActiveMask & (1u << Lane)) && Elapsed[Lane] * InvDuration[Lane] >= 1.0f)
+        {
+            Amplitude[Lane] = 0.0f;
+            Elapsed[Lane] = 0.0f;
+            ActiveMask &= ~(1u << Lane);
+        }
+    }
+
+    return FRotator(HorizontalSum(Sum[0]), HorizontalSum(Sum[1]), HorizontalSum(Sum[2]));
+}
+
+void FCameraShakeBank::StopAll()
+{
+    FMemory::Memzero(Amplitude);
+    FMemory::Memzero(Frequency);
+    FMemory::Memzero(Elapsed);
+    FMemory::Memzero(InvDuration);
+    FMemory::Memzero(PerlinWeight);
+    ActiveMask = 0;
+}
+
+int32 FCameraShakeBank::FindLane() const
+{
+    // First free lane, otherwise steal the one closest to finishing
+    int32 BestLane = 0;
+    float BestProgress = -1.0f;
+    for (int32 Lane = 0; Lane < Capacity; ++Lane)
+    {
+        if (!(ActiveMask & (1u << Lane)))
+        {
+            return Lane;
+        }
+
+        const float Progress = Elapsed[Lane] * InvDuration[Lane];
+        if (Progress > BestProgress)
+        {
+            BestProgress = Progress;
+            BestLane = Lane;
+        }
+    }
+    return BestLane;
+}
@@ -0,0 +1,227 @@
+#include "CameraSpectatorPose.h"
+
+// FOV travels as quarter degrees in 10 bits
+static constexpr float FOVSteps = 4.0f;
+static constexpr uint32 MaxFOVValue = 1024;
+
+static void SerializeFieldOfView(FArchive& Ar, float& FieldOfView)
+{
+    uint32 Quantized = Ar.IsSaving() ? static_cast<uint32>(FMath::Clamp(FMath::RoundToInt(FieldOfView * FOVSteps), 0, static_cast<int32>(MaxFOVValue) - 1)) : 0;
+    Ar.SerializeInt(Quantized, MaxFOVValue);
+    if (Ar.IsLoading())
+    {
+        FieldOfView = Quantized / FOVSteps;
+    }
+}
+
+// Zigzag maps small negative deltas to small unsigned values so they pack into few bytes
+static void SerializeSignedPacked(FArchive& Ar, int32& Value)
+{
+    uint32 Encoded = Ar.IsSaving() ? (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31) : 0;
+    Ar.SerializeIntPacked(Encoded);
+    if (Ar.IsLoading())
+    {
+        Value = static_cast<int32>(Encoded >> 1) ^ -static_cast<int32>(Encoded & 1);
+    }
+}
+
+void FCameraSpectatorPose::Quantize()
+{
+    Location = FVector(FMath::RoundToDouble(Location.X), FMath::RoundToDouble(Location.Y), FMath::RoundToDouble(Location.Z));
+    Rotation = FRotator(
+        FRotator::DecompressAxisFromShort(FRotator::CompressAxisToShort(Rotation.Pitch)),
+        FRotator::DecompressAxisFromShort(FRotator::CompressAxisToShort(Rotation.Yaw)),
+        FRotator::DecompressAxisFromShort(FRotator::CompressAxisToShort(Rotation.Roll)));
+    FieldOfView = FMath::Clamp(FMath::RoundToFloat(FieldOfView * FOVSteps), 0.0f, MaxFOVValue - 1.0f) / FOVSteps;
+}
+
+bool FCameraSpectatorPose::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    bOutSuccess = SerializePackedVector<1, 24>(Location, Ar);
+    Rotation.SerializeCompressedShort(Ar);
+    SerializeFieldOfView(Ar, FieldOfView);
+    return true;
+}
+
+bool FCameraSpectatorPosePacket::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    bOutSuccess = true;
+    Ar << Sequence;
+
+    uint8 bBase = bHasBase ? 1 : 0;
+    Ar.SerializeBits(&bBase, 1);
+    bHasBase = bBase != 0;
+
+    if (bHasBase)
+    {
+        Ar << BaseSequence;
+        SerializeSignedPacked(Ar, LocationDelta.X);
+        SerializeSignedPacked(Ar, LocationDelta.Y);
+        SerializeSignedPacked(Ar, LocationDelta.Z);
+    }
+    else
+    {
+        bOutSuccess = SerializePackedVector<1, 24>(Location, Ar);
+    }
+
+    Rotation.SerializeCompressedShort(Ar);
+    SerializeFieldOfView(Ar, FieldOfView);
+    return true;
+}
+
+bool FCameraSpectatorPoseSender::Update(float DeltaTime, FCameraSpectatorPose& Pose, const FCameraSpectatorSendSettings& Settings, FCameraSpectatorPosePacket& OutPacket)
+{
+    TimeSinceSend += DeltaTime;
+    Pose.Quantize();
+
+    if (bHasSent)
+    {
+        const FCameraSpectatorPose& Last = Sent[static_cast<uint8>(NextSequence - 1) % HistorySize];
+        const bool bMoved = !Last.Location.Equals(Pose.Location, Settings.LocationThreshold)
+            || !Last.Rotation.Equals(Pose.Rotation, Settings.RotationThreshold)
+            || FMath::Abs(Last.FieldOfView - Pose.FieldOfView) > Settings.FOVThreshold;
+
+        // Below the thresholds, still send at the slowest rate until the exact pose has been acknowledged
+        const bool bSettled = Last.Location == Pose.Location && Last.Rotation == Pose.Rotation && Last.FieldOfView == Pose.FieldOfView
+            && bHasAck && AckedSequence == static_cast<uint8>(NextSequence - 1);
+
+        const bool bDue = bMoved ? TimeSinceSend >= Settings.MinSendInterval : (TimeSinceSend >= Settings.MaxSendInterval && !bSettled);
+        if (!bDue)
+        {
+            return false;
+        }
+    }
+
+    OutPacket.Sequence = NextSequence;
+    OutPacket.bHasBase = bHasAck && static_cast<uint8>(NextSequence - AckedSequence) < HistorySize;
+    if (OutPacket.bHasBase)
+    {
+        const FVector Delta = Pose.Location - Sent[AckedSequence % HistorySize].Location;
+        OutPacket.BaseSequence = AckedSequence;
+        OutPacket.LocationDelta = FIntVector(FMath::RoundToInt(Delta.X), FMath::RoundToInt(Delta.Y), FMath::RoundToInt(Delta.Z));
+    }
+    else
+    {
+        OutPacket.Location = Pose.Location;
+    }
+    OutPacket.Rotation = Pose.Rotation;
+    OutPacket.FieldOfView = Pose.FieldOfView;
+
+    Sent[NextSequence % HistorySize] = Pose;
+    ++NextSequence;
+    TimeSinceSend = 0.0f;
+    bHasSent = true;
+    return true;
+}
+
+void FCameraSpectatorPoseSender::Acknowledge(uint8 Sequence)
+{
+    // Ignore stale acks and acks for poses that have left the history
+    const bool bRecent = static_cast<uint8>(NextSequence - Sequence) <= HistorySize;
+    if (bRecent && (!bHasAck || static_cast<int8>(Sequence - AckedSequence) > 0))
+    {
+        AckedSequence = Sequence;
+        bHasAck = true;
+    }
+}
+
+void FCameraSpectatorPoseSender::Reset()
+{
+    TimeSinceSend = 0.0f;
+    NextSequence = 0;
+    AckedSequence = 0;
+    bHasAck = false;
+    bHasSent = false;
+}
+
+bool FCameraSpectatorPoseReceiver::Decode(const FCameraSpectatorPosePacket& Packet, FCameraSpectatorPose& OutPose)
+{
+    if (bHasLatest && static_cast<int8>(Packet.Sequence - LatestSequence) <= 0)
+    {
+        return false;
+    }
+
+    FCameraSpectatorPose Pose;
+    if (Packet.bHasBase)
+    {
+        const int32 BaseSlot = Packet.BaseSequence % FCameraSpectatorPoseSender::HistorySize;
+        if (!bReceived[BaseSlot] || ReceivedSequence[BaseSlot] != Packet.BaseSequence)
+        {
+            return false;
+        }
+        Pose.Location = Received[BaseSlot].Location + FVector(Packet.LocationDelta);
+    }
+    else
+    {
+        Pose.Location = Packet.Location;
+    }
+    Pose.Rotation = Packet.Rotation;
+    Pose.FieldOfView = Packet.FieldOfView;
+
+    const int32 Slot = Packet.Sequence % FCameraSpectatorPoseSender::HistorySize;
+    Received[Slot] = Pose;
+    ReceivedSequence[Slot] = Packet.Sequence;
+    bReceived[Slot] = true;
+    LatestSequence = Packet.Sequence;
+    bHasLatest = true;
+
+    OutPose = Pose;
+    return true;
+}
+
+void FCameraSpectatorPoseReceiver::Reset()
+{
+    FMemory::Memzero(bReceived);
+    bHasLatest = false;
+}
+
+void FCameraSpectatorPoseInterpolator::Push(const FCameraSpectatorPose& Pose, double Time, float HoldInterval)
+{
+    // Nothing arrives while the sender's pose is still, so the previous pose was held until shortly before this one
+    if (Num > 0 && Time - Snapshots[Head].Time > HoldInterval)
+    {
+        Snapshots[Head].Time = Time - HoldInterval;
+    }
+
+    Head = (Head + 1) % Capacity;
+    Snapshots[Head].Pose = Pose;
+    Snapshots[Head].Time = Time;
+    Num = FMath::Min(Num + 1, Capacity);
+}
+
+bool FCameraSpectatorPoseInterpolator::Sample(double Time, FCameraSpectatorPose& OutPose) const
+{
+    if (Num == 0)
+    {
+        return false;
+    }
+
+    if (Time >= Get(0).Time)
+    {
+        OutPose = Get(0).Pose;
+        return true;
+    }
+
+    for (int32 Age = 1; Age < Num; ++Age)
+    {
+        const FSnapshot& Older = Get(Age);
+        if (Older.Time <= Time)
+        {
+            const FSnapshot& Newer = Get(Age - 1);
+            const float Alpha = static_cast<float>((Time - Older.Time) / FMath::Max(Newer.Time - Older.Time, UE_SMALL_NUMBER));
+            OutPose.Location = FMath::Lerp(Older.Pose.Location, Newer.Pose.Location, Alpha);
+            OutPose.Rotation = FMath::Lerp(Older.Pose.Rotation, Newer.Pose.Rotation, Alpha);
+            OutPose.FieldOfView = FMath::Lerp(Older.Pose.FieldOfView, Newer.Pose.FieldOfView, Alpha);
+            return true;
+        }
+    }
+
+    OutPose = Get(Num - 1).Pose;
+    return true;
+}
+
+void FCameraSpectatorPoseInterpolator::Reset()
+{
+    Head = 0;
+    Num = 0;
+}
@@ -1,253 +1,892 @@
 #include "CustomCameraComponent.h"
 #include "GameFramework/Actor.h"
 #include "Camera/CameraShakeBase.h"
-#include "Components/PostProcessComponent.h"
 #include "Sound/SoundCue.h"
 #include "Kismet/GameplayStatics.h"
-#include "Engine/PostProcessVolume.h"
 #include "Materials/MaterialInstanceDynamic.h"
-#include "Components/AudioComponent.h"
 #include "Engine/World.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "CollisionQueryParams.h"
-#include "DrawDebugHelpers.h"
+#include "KryoDebugDraw.h"
 #include "TimerManager.h"
 #include "GameFramework/Pawn.h" // For APawn
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "CustomCameraSubsystem.h"
+#include "CustomCameraProfile.h"
+#include "CameraSpring.h"
+#include "CameraRailActor.h"
+#include "CameraHintVolume.h"
+#include "Net/UnrealNetwork.h"
+#include "Algo/Sort.h"
+
+// Radius of the sweep that keeps a framed camera out of walls (cm)
+static constexpr float FramingProbeRadius = 12.0f;
 
 UCustomCameraComponent::UCustomCameraComponent()
 {
-    PrimaryComponentTick.bCanEverTick = true;
+    // Updated in a batch by UCustomCameraSubsystem rather than through a component tick
+    PrimaryComponentTick.bCanEverTick = false;
+    Profile = nullptr;
+    Tuning = GetDefault<UCustomCameraProfile>();
+    EnabledFeatures = ECameraHotFeature::None;
     CameraMode = ECameraMode::ThirdPerson;
-    bIsTransitioning = false;
-    TransitionElapsedTime = 0.0f;
-    TransitionTotalDuration = 0.0f;
-    WarpElapsedTime = 0.0f;
-    WarpTotalDuration = 0.0f;
-    OriginalFOV = 90.0f; // Default value, can be overridden in the editor
     CurrentRotation = FRotator::ZeroRotator;
 
-    // Initialize audio component
-    //WarpAudioComponent = CreateDefaultSubobject<UAudioComponent>(TEXT("WarpAudioComponent"));
-    //WarpAudioComponent->SetupAttachment(this);
-    //WarpAudioComponent->bAutoActivate = false;
-
-    // Initialize default camera positions
-    FirstPersonPosition = FVector(0.0f, 0.0f, 0.0f);
-    ThirdPersonPosition = FVector(-300.0f, 0.0f, 100.0f);
-    AimPositionFirstPerson = FVector(0.0f, 0.0f, 0.0f);
-    AimPositionThirdPerson = FVector(-300.0f, 0.0f, 100.0f);
-
-    // Initialize FOV settings
-    DefaultFOV = 90.0f;
-    AimingFOV = 60.0f;
-    TransitionSpeed = 5.0f;
-    ZoomedFOV = 80.0f;
-    SprintFOV = 70.0f;
-
-    // Initialize rotation and sway settings
-    MaxYawRotation = 90.0f;
-    MaxPitchRotation = 45.0f;
-    RotationSpeed = 2.0f;
-    SwayAmount = 5.0f;
-    SwaySpeed = 2.0f;
-
-    // Initialize bobbing settings
-    RunningBobMagnitude = 10.0f;
-    WalkingBobMagnitude = 5.0f;
-    BobFrequency = 10.0f;
-
-    // Initialize post-process settings
-    DepthOfField = 1000.0f;
-    MotionBlurAmount = 1.0f;
-    ColorGradingIntensity = 1.0f;
-    VignetteIntensity = 0.5f;
-
-    // Initialize feature toggles
-    bEnableHeadBobbing = true;
-    bEnableCameraSway = true;
-    bEnableTerrainTilt = false;
-    bEnableCameraLag = true;
-    CameraLagSpeed = 5.0f;
-    bEnableDynamicFOV = true;
-    DynamicZoomThreshold = 500.0f;
-    DynamicZoomSpeed = 2.0f;
-    bEnableContextualPositioning = false;
-    bEnableIntelligentFraming = false;
-    bEnableAdaptiveDepthOfField = false;
-    FocusDistance = 1000.0f;
-    bEnableCollisionPrediction = false;
-    bEnableEnvironmentalAwareness = false;
-    bEnableFocusBasedFOV = false;
-    bEnableAdvancedMotionBlur = false;
-    bEnableCameraInertia = false;
-    CameraInertiaStrength = 5.0f;
-
-    // Initialize collision defaults
-    MinCameraHeight = 50.0f;
-    MaxCameraHeight = 300.0f;
-
     // Initialize dynamic material instances
     FadeMaterialInstance = nullptr;
     OcclusionMaterialInstance = nullptr;
+    PostProcessMaterialInstance = nullptr;
 
     // Initialize camera state flags
     bIsRunning = false;
     bIsAiming = false;
     bIsFirstPersonMode = false;
 
-    // Initialize warp effect variables
-    WarpMaxFOVIncrease = 30.0f;
-    WarpVignetteIntensity = 1.0f;
-    WarpMotionBlurAmount = 2.0f;
-    WarpDuration = 2.0f;
-    WarpElapsedTime = 0.0f;
-    WarpTotalDuration = WarpDuration;
-    WarpStartFOV = DefaultFOV;
-    WarpEndFOV = DefaultFOV + WarpMaxFOVIncrease;
-
-    // Initialize transition variables
-    bIsTransitioning = false;
-    TransitionElapsedTime = 0.0f;
-    TransitionTotalDuration = 0.0f;
-    TransitionStartPosition = GetRelativeLocation();
-    TransitionTargetPosition = ThirdPersonPosition;
-    TransitionStartFOV = FieldOfView;
-    TransitionTargetFOV = DefaultFOV;
-
-    // Initialize LastObstacleDetectionTime
-    LastObstacleDetectionTime = 0.0f;
+    // Initialize pose pipeline state
+    FreeCameraLocation = Tuning->ThirdPersonPosition;
+    CinematicLocation = Tuning->ThirdPersonPosition;
+    CinematicRotation = FRotator::ZeroRotator;
+    CinematicFOV = Tuning->DefaultFOV;
+    CinematicRail = nullptr;
+    CinematicRailDistance = 0.0f;
+    ReplaySource = nullptr;
+    ReplaySerial = 0.0;
+    ReplayEndSerial = 0.0;
+    ReplayPlayRate = 1.0f;
+    bReplayingPoses = false;
+    FMemory::Memzero(ReplaySavedLayerWeights);
+    bSpectatorViewRegistered = false;
+    PendingModePose = FCameraPoseAccumulator(Tuning->ThirdPersonPosition, FRotator::ZeroRotator, Tuning->DefaultFOV);
+    BaseFOV = Tuning->DefaultFOV;
+    LastModeFOV = Tuning->DefaultFOV;
+    ShoulderOffset = FVector::ZeroVector;
+    ObstacleOffset = FVector::ZeroVector;
+    InertiaRotation = FRotator::ZeroRotator;
+    FramingRotation = FRotator::ZeroRotator;
+    FramingCenter = FVector::ZeroVector;
+    FramingCenterVelocity = FVector::ZeroVector;
+    FramingDistance = 0.0f;
+    FramingDistanceVelocity = 0.0f;
+    FramingFOV = 90.0f;
+    FramingFOVVelocity = 0.0f;
+    FramingWeight = 0.0f;
+    FramingWeightVelocity = 0.0f;
+    FramingSafeDistance = -1.0f;
+    HintBlendSpeed = 3.0f;
+    HintLagSpeed = 0.0f;
+    HintOffset = FVector::ZeroVector;
+    HintOffsetVelocity = FVector::ZeroVector;
+    HintFOVDelta = 0.0f;
+    HintFOVDeltaVelocity = 0.0f;
+    HintLagWeight = 0.0f;
+    HintLagWeightVelocity = 0.0f;
+    HintLagLocation = FVector::ZeroVector;
+    HintLagVelocity = FVector::ZeroVector;
+    bHintLagValid = false;
+    FMemory::Memzero(AutofocusHistory);
+    AutofocusHistoryNum = 0;
+    AutofocusHistoryHead = 0;
+    AutofocusDistance = -1.0f;
+    AutofocusVelocity = 0.0f;
+    AppliedFocusDistance = -1.0f;
+    TerrainTilt = FRotator::ZeroRotator;
+    TerrainTargetTilt = FRotator::ZeroRotator;
+    PredictionDistance = -1.0f;
+    PredictionDistanceVelocity = 0.0f;
+    PredictionTargetDistance = -1.0f;
+    PredictionSweepStart = FVector::ZeroVector;
+    PredictionSweepEnd = FVector::ZeroVector;
+    PredictionSweepPivot = FVector::ZeroVector;
+    PredictionSweepOrigin = FVector::ZeroVector;
+    CollisionPushBack = FVector::ZeroVector;
+
+    bCameraUpdatesActive = false;
+    PoseRecorderSeconds = 0.0f;
+    PoseRecorderRate = 0.0f;
+    CachedOwnerPawn = nullptr;
+    PendingFreeCameraInput = FVector2D::ZeroVector;
+    CameraSubsystem = nullptr;
+    BobPhase = 0.0f;
+    SwayPhase = 0.0f;
+    RecoilRotation = FRotator::ZeroRotator;
+    SimulationAccumulator = 0.0f;
+    StepOscillationOffset = FVector::ZeroVector;
+    StepDesiredRotation = FRotator::ZeroRotator;
+    FramingVelocity = FRotator::ZeroRotator;
+    TerrainTiltVelocity = FRotator::ZeroRotator;
+    BasePoseSerial = 0;
+    GatheredBasePoseSerial = 0;
+}
+
+void UCustomCameraComponent::OnRegister()
+{
+    CachedOwnerPawn = Cast<APawn>(GetOwner());
+    Super::OnRegister();
+    ApplyProfile();
+
+#if WITH_EDITOR
+    if (!ProfileChangedHandle.IsValid())
+    {
+        ProfileChangedHandle = UCustomCameraProfile::OnProfileChanged.AddUObject(this, &UCustomCameraComponent::OnProfileChanged);
+    }
+#endif
+}
+
+void UCustomCameraComponent::OnUnregister()
+{
+#if WITH_EDITOR
+    UCustomCameraProfile::OnProfileChanged.Remove(ProfileChangedHandle);
+    ProfileChangedHandle.Reset();
+#endif
+    Super::OnUnregister();
+}
+
+#if WITH_EDITOR
+void UCustomCameraComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+    if (PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UCustomCameraComponent, Profile))
+    {
+        ApplyProfile();
+    }
+}
+
+void UCustomCameraComponent::OnProfileChanged(const UCustomCameraProfile* ChangedProfile)
+{
+    if (ChangedProfile == Tuning)
+    {
+        ApplyProfile();
+    }
+}
+#endif
+
+void UCustomCameraComponent::SetProfile(UCustomCameraProfile* NewProfile)
+{
+    Profile = NewProfile;
+    ApplyProfile();
+}
+
+void UCustomCameraComponent::ApplyProfile()
+{
+    Tuning = Profile ? Profile : GetDefault<UCustomCameraProfile>();
+
+    CollisionProbeCache.Configure(Tuning->ProbeCacheLocationEpsilon, Tuning->ProbeCacheAngleEpsilon, Tuning->ProbeCacheMaxAge, Tuning->ProbeCacheMissMaxAge);
+    PredictionProbeCache.Configure(Tuning->CollisionPredictionRecheckDistance, Tuning->ProbeCacheAngleEpsilon, Tuning->ProbeCacheMaxAge, Tuning->ProbeCacheMissMaxAge);
+    OcclusionFader.Configure(Tuning->OcclusionFadeDataIndex, Tuning->OcclusionFadeInTime, Tuning->OcclusionFadeOutTime, Tuning->OcclusionTransparencyStrength);
+
+    FCameraOccluderTrackerSettings OccluderSettings;
+    OccluderSettings.RaysPerTarget = Tuning->OcclusionRaysPerTarget;
+    OccluderSettings.FanRadius = Tuning->OcclusionFanRadius;
+    OccluderSettings.bUseSphereSweep = Tuning->bOcclusionUseSphereSweep;
+    OccluderSettings.SweepRadius = Tuning->OcclusionSweepRadius;
+    OccluderSettings.FadeInSamples = Tuning->OcclusionFadeInSamples;
+    OccluderSettings.FadeOutSamples = Tuning->OcclusionFadeOutSamples;
+    OccluderSettings.MaxTrackedOccluders = Tuning->MaxTrackedOccluders;
+    OccluderTracker.Configure(OccluderSettings);
+    ShakeBank.BuildActionTable(Tuning->CameraShakeMappings);
+    const bool bRecorderChanged = !PoseRecorder.IsInitialized() || PoseRecorderSeconds != Tuning->PoseRecordSeconds || PoseRecorderRate != Tuning->PoseRecordRate;
+    if (Tuning->bRecordPoses && bRecorderChanged)
+    {
+        PoseRecorder.Initialize(Tuning->PoseRecordSeconds, Tuning->PoseRecordRate);
+        PoseRecorderSeconds = Tuning->PoseRecordSeconds;
+        PoseRecorderRate = Tuning->PoseRecordRate;
+    }
+
+    EnabledFeatures = BuildFeatureMask();
+    RefreshObstacleDetectionTimer();
+
+    // Only spectating needs the component on the network
+    SetIsReplicated(Tuning->bReplicateToSpectators);
+
+    // Cached probe results were taken with the previous epsilons
+    InvalidateProbeCache();
 }
 
 void UCustomCameraComponent::BeginPlay()
 {
     Super::BeginPlay();
-    // Set view target with blend
-    APawn* OwnerPawn = Cast<APawn>(GetOwner());
-    if (OwnerPawn)
+    QueryBatcher.Initialize(GetOwner());
+    InitializeCamera();
+    SetupPostProcessMaterial();
+
+    // Possession changes arrive here on both the server and the owning client
+    if (CachedOwnerPawn)
+    {
+        CachedOwnerPawn->ReceiveControllerChangedDelegate.AddUniqueDynamic(this, &UCustomCameraComponent::OnOwnerControllerChanged);
+    }
+    RefreshNetRoleGating();
+}
+
+void UCustomCameraComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (CachedOwnerPawn)
     {
-        APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0);
-        if (PC)
+        CachedOwnerPawn->ReceiveControllerChangedDelegate.RemoveDynamic(this, &UCustomCameraComponent::OnOwnerControllerChanged);
+    }
+    SetCameraUpdatesActive(false);
+    if (bSpectatorViewRegistered)
+    {
+        if (UCustomCameraSubsystem* Subsystem = GetWorld() ? GetWorld()->GetSubsystem<UCustomCameraSubsystem>() : nullptr)
         {
-            PC->SetViewTargetWithBlend(OwnerPawn, 1.0f, EViewTargetBlendFunction::VTBlend_Cubic);
+            Subsystem->UnregisterSpectatorCamera(this);
         }
+        bSpectatorViewRegistered = false;
+    }
+    RestoreOccludedObjects();
+    QueryBatcher.Reset();
+    PostProcessStack.Reset();
+    PostProcessStack.Push(PostProcessSettings);
+    MaterialInstancePool.Empty();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UCustomCameraComponent::RefreshNetRoleGating()
+{
+    SetCameraUpdatesActive(ShouldUpdateCamera());
+}
+
+bool UCustomCameraComponent::CanEverUpdateCamera() const
+{
+    const UWorld* World = GetWorld();
+    return World && !World->IsNetMode(NM_DedicatedServer);
+}
+
+bool UCustomCameraComponent::ShouldUpdateCamera() const
+{
+    if (!CanEverUpdateCamera())
+    {
+        return false;
     }
-    InitializeCamera();
-    SetupPostProcessMaterial();
 
-    if (bEnableDynamicObstacleDetection)
+    if (CachedOwnerPawn)
     {
-        GetWorld()->GetTimerManager().SetTimer(ObstacleDetectionTimerHandle, this, &UCustomCameraComponent::PerformDynamicObstacleDetection, ObstacleDetectionInterval, true);
+        return CachedOwnerPawn->IsLocallyControlled();
     }
+    return GetOwnerRole() != ROLE_SimulatedProxy;
+}
+
+void UCustomCameraComponent::SetCameraUpdatesActive(bool bActive)
+{
+    if (bActive == bCameraUpdatesActive)
+    {
+        return;
+    }
+    bCameraUpdatesActive = bActive;
+
+    UWorld* World = GetWorld();
+    if (bActive)
+    {
+        CameraSubsystem = World ? World->GetSubsystem<UCustomCameraSubsystem>() : nullptr;
+        if (CameraSubsystem)
+        {
+            CameraSubsystem->RegisterCamera(this);
+        }
+
+        RefreshObstacleDetectionTimer();
+
+        // Set view target with blend
+        if (APlayerController* PC = CachedOwnerPawn ? Cast<APlayerController>(CachedOwnerPawn->GetController()) : nullptr)
+        {
+            PC->SetViewTargetWithBlend(CachedOwnerPawn, 1.0f, EViewTargetBlendFunction::VTBlend_Cubic);
+        }
+    }
+    else
+    {
+        if (CameraSubsystem)
+        {
+            CameraSubsystem->UnregisterCamera(this);
+            CameraSubsystem = nullptr;
+        }
+
+        RefreshObstacleDetectionTimer();
+
+        // Nothing will fade occluders back or harvest in-flight probes while the camera is idle
+        RestoreOccludedObjects();
+        QueryBatcher.Reset();
+        CollisionProbeCache.Invalidate();
+        PredictionProbeCache.Invalidate();
+        PredictionDistance = -1.0f;
+        PredictionTargetDistance = -1.0f;
+        FramingSafeDistance = -1.0f;
+        bHintLagValid = false;
+        ShakeBank.StopAll();
+    }
+}
+
+void UCustomCameraComponent::RefreshObstacleDetectionTimer()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    // Setting the timer again restarts it at the current interval
+    if (bCameraUpdatesActive && EnumHasAnyFlags(EnabledFeatures, ECameraHotFeature::ObstacleDetection))
+    {
+        World->GetTimerManager().SetTimer(ObstacleDetectionTimerHandle, this, &UCustomCameraComponent::PerformDynamicObstacleDetection, Tuning->ObstacleDetectionInterval, true);
+    }
+    else
+    {
+        World->GetTimerManager().ClearTimer(ObstacleDetectionTimerHandle);
+    }
+}
+
+void UCustomCameraComponent::OnOwnerControllerChanged(APawn* Pawn, AController* OldController, AController* NewController)
+{
+    RefreshNetRoleGating();
 }
 
 void UCustomCameraComponent::InitializeCamera()
 {
-    SetFieldOfView(DefaultFOV);
-    SetRelativeLocation(ThirdPersonPosition);
+    PostProcessBlendWeight = 1.0f;
+    PostProcessStack.SetLayerWeight(ECameraPostProcessLayer::Base, 1.0f);
+
     CurrentRotation = GetRelativeRotation();
+    InertiaRotation = CurrentRotation;
+    FramingRotation = CurrentRotation;
+    bIsFirstPersonMode = CameraMode == ECameraMode::FirstPerson;
+
+    // Start in the configured mode without blending in from the component's placement
+    ModeStack.Reset();
+    ModeStack.Push(CameraMode, 0.0f, Tuning->ModeBlendOption);
+    PendingModePose = ModeStack.Evaluate(MakeModeContext(FCameraFrameInput()), 0.0f);
+    BaseFOV = PendingModePose.FieldOfView;
+    LastModeFOV = BaseFOV;
+
+    StepDesiredRotation = CurrentRotation;
+    PreviousSimulationStep.FieldOfView = BaseFOV;
+    PreviousSimulationStep.Rotation = CurrentRotation;
+    SimulationAccumulator = 0.0f;
+
+    SetFieldOfView(BaseFOV);
+    SetRelativeLocationAndRotation(PendingModePose.Location, CurrentRotation);
 }
 
-void UCustomCameraComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UCustomCameraComponent::GatherCameraUpdate(float DeltaTime, FCameraHotStateArrays& Hot, int32 Index)
 {
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-    UpdateCamera(DeltaTime);
-    UpdateCameraRotation(DeltaTime);
-    UpdateDynamicFOV(DeltaTime);
-    UpdateTransition(DeltaTime);
-    HandleCameraCollision();
-    UpdateBasedOnTerrain();
+    // Results of the probes submitted last frame become visible to this frame's modifiers
+    QueryBatcher.BeginFrame(GetWorld());
+
+    PendingFrameInput = GatherFrameInput(DeltaTime);
+    ConsumeFreeCameraInput(PendingFrameInput);
+    UpdateCinematicRail(PendingFrameInput);
 
-    if (bEnableDynamicZoom)
+    // 1. Base: blend the active modes; FOV arbitration restarts from the mode FOV whenever it moves
+    PendingModePose = ModeStack.Evaluate(MakeModeContext(PendingFrameInput), DeltaTime);
+    if (!FMath::IsNearlyEqual(PendingModePose.FieldOfView, LastModeFOV))
     {
-        PerformDynamicZoom();
+        LastModeFOV = PendingModePose.FieldOfView;
+        BaseFOV = LastModeFOV;
     }
+    GatheredBasePoseSerial = BasePoseSerial;
+
+    FCameraHotSettings& Settings = Hot.Settings[Index];
+    Settings.DefaultFOV = PendingModePose.FieldOfView;
+    Settings.AimingFOV = Tuning->AimingFOV;
+    Settings.SprintFOV = Tuning->SprintFOV;
+    Settings.ZoomedFOV = Tuning->ZoomedFOV;
+    Settings.DynamicZoomThreshold = Tuning->DynamicZoomThreshold;
+    Settings.DynamicZoomSpeed = Tuning->DynamicZoomSpeed;
+    Settings.FocusDistance = Tuning->FocusDistance;
+    Settings.WalkingBobMagnitude = Tuning->WalkingBobMagnitude;
+    Settings.RunningBobMagnitude = Tuning->RunningBobMagnitude;
+    Settings.BobFrequency = Tuning->BobFrequency;
+    Settings.SwayAmount = Tuning->SwayAmount;
+    Settings.SwaySpeed = Tuning->SwaySpeed;
+    Settings.OverShoulderOffset = Tuning->OverShoulderOffset;
+    Settings.RepositioningSpeed = Tuning->RepositioningSpeed;
+    Settings.InertiaStrength = Tuning->CameraInertiaStrength;
+    Settings.RecoilRecoverySpeed = Tuning->RecoilRecoverySpeed;
+    Settings.FixedStep = Tuning->CameraSimulationRate > 0.0f ? 1.0f / Tuning->CameraSimulationRate : 0.0f;
+
+    Hot.Features[Index] = EnabledFeatures;
+    Hot.DeltaTime[Index] = DeltaTime;
+    Hot.Speed[Index] = PendingFrameInput.Speed;
+    Hot.bIsAiming[Index] = bIsAiming;
+    Hot.bIsRunning[Index] = bIsRunning;
+    Hot.LookRotation[Index] = PendingModePose.Rotation;
+
+    Hot.FieldOfView[Index] = BaseFOV;
+    Hot.BobPhase[Index] = BobPhase;
+    Hot.SwayPhase[Index] = SwayPhase;
+    Hot.ShoulderOffset[Index] = ShoulderOffset;
+    Hot.InertiaRotation[Index] = InertiaRotation;
+    Hot.RecoilRotation[Index] = RecoilRotation;
+    Hot.Springs[Index] = SimulationSprings;
+    Hot.StepAccumulator[Index] = SimulationAccumulator;
+    Hot.PreviousStep[Index] = PreviousSimulationStep;
+    Hot.OscillationOffset[Index] = StepOscillationOffset;
+    Hot.DesiredRotation[Index] = StepDesiredRotation;
+}
 
-    if (bEnableContextualPositioning)
+void UCustomCameraComponent::ApplyCameraUpdate(const FCameraHotStateArrays& Hot, int32 Index)
+{
+    // Write back the state the batched pass carried forward, unless gameplay changed the base pose since gather
+    if (GatheredBasePoseSerial == BasePoseSerial)
     {
-        UpdateContextualPositioning();
+        BaseFOV = Hot.FieldOfView[Index];
+    }
+    BobPhase = Hot.BobPhase[Index];
+    SwayPhase = Hot.SwayPhase[Index];
+    ShoulderOffset = Hot.ShoulderOffset[Index];
+    InertiaRotation = Hot.InertiaRotation[Index];
+    RecoilRotation = Hot.RecoilRotation[Index];
+    SimulationSprings = Hot.Springs[Index];
+    SimulationAccumulator = Hot.StepAccumulator[Index];
+    PreviousSimulationStep = Hot.PreviousStep[Index];
+    StepOscillationOffset = Hot.OscillationOffset[Index];
+    StepDesiredRotation = Hot.DesiredRotation[Index];
+
+    const FCameraFrameInput& Input = PendingFrameInput;
+    if (bReplayingPoses)
+    {
+        ApplyPoseReplay(Input);
+        QueryBatcher.Flush(GetWorld());
+        return;
     }
 
-    if (bEnableIntelligentFraming)
+    const FCameraHotStepOutput& Simulated = Hot.Output[Index];
+    FCameraPoseAccumulator Pose(PendingModePose.Location, PendingModePose.Rotation, Simulated.FieldOfView);
+    DispatchCameraFeatures(Hot.Features[Index], [this, &Input, &Simulated, &Pose](auto Enabled)
     {
-        UpdateIntelligentFraming();
+        ApplySceneModifiers(Input, Simulated, Pose, Enabled);
+        CommitPose(Input, Pose);
+        UpdateFrameEffects(Input, Enabled);
+    });
+
+    RecordPose(Input, Pose);
+    SendSpectatorPose(Input, Pose);
+
+    QueryBatcher.Flush(GetWorld());
+}
+
+ECameraHotFeature UCustomCameraComponent::BuildFeatureMask() const
+{
+    ECameraHotFeature Features = ECameraHotFeature::None;
+    if (Tuning->bEnableDynamicFOV) Features |= ECameraHotFeature::DynamicFOV;
+    if (Tuning->bEnableDynamicZoom && CachedOwnerPawn) Features |= ECameraHotFeature::DynamicZoom;
+    if (Tuning->bEnableFocusBasedFOV && CachedOwnerPawn) Features |= ECameraHotFeature::FocusFOV;
+    if (Tuning->bEnableOverShoulderRepositioning) Features |= ECameraHotFeature::ShoulderOffset;
+    if (Tuning->bEnableHeadBobbing) Features |= ECameraHotFeature::HeadBob;
+    if (Tuning->bEnableCameraSway) Features |= ECameraHotFeature::Sway;
+    if (Tuning->bEnableCameraInertia) Features |= ECameraHotFeature::Inertia;
+    if (Tuning->bEnableRecoil) Features |= ECameraHotFeature::Recoil;
+    if (Tuning->bEnableContextualPositioning) Features |= ECameraHotFeature::ContextualPositioning;
+    if (Tuning->bEnableCollisionPrediction) Features |= ECameraHotFeature::CollisionPrediction;
+    if (Tuning->bEnableDynamicObstacleDetection) Features |= ECameraHotFeature::ObstacleDetection;
+    if (Tuning->bEnableIntelligentFraming) Features |= ECameraHotFeature::IntelligentFraming;
+    if (Tuning->bEnableTerrainTilt) Features |= ECameraHotFeature::TerrainTilt;
+    if (Tuning->bEnableAdaptiveDepthOfField) Features |= ECameraHotFeature::AdaptiveDepthOfField;
+    if (Tuning->bEnableAdvancedMotionBlur) Features |= ECameraHotFeature::MotionBlur;
+    if (Tuning->bEnableDynamicObjectTransparency) Features |= ECameraHotFeature::ObjectTransparency;
+    return Features;
+}
+
+template<typename TFeatures>
+void UCustomCameraComponent::ApplySceneModifiers(const FCameraFrameInput& Input, const FCameraHotStepOutput& Simulated, FCameraPoseAccumulator& Pose, TFeatures Enabled)
+{
+    // 3. Positional offsets
+    if (Enabled.Has(ECameraHotFeature::ShoulderOffset))
+    {
+        Pose.AddLocalOffset(Simulated.ShoulderOffset);
     }
 
-    if (bEnableAdaptiveDepthOfField)
+    if (Enabled.Has(ECameraHotFeature::ContextualPositioning))
     {
-        UpdateAdaptiveDepthOfField();
+        UpdateContextualPositioning(Input, Pose);
     }
 
-    if (bEnableCollisionPrediction)
+    Pose.AddLocalOffset(Simulated.OscillationOffset);
+
+    // 4. Collision
+    HandleCameraCollision(Input, Pose);
+
+    if (Enabled.Has(ECameraHotFeature::CollisionPrediction))
     {
-        PredictAndPreventCollisions();
+        PredictAndPreventCollisions(Input, Pose);
     }
 
-    if (bEnableEnvironmentalAwareness)
+    if (Enabled.Has(ECameraHotFeature::ObstacleDetection))
     {
-        UpdateEnvironmentalAwareness();
+        ApplyDynamicObstacleDetection(Input, Pose);
     }
 
-    if (bEnableFocusBasedFOV)
+    // 5. Rotation
+    Pose.Rotation = Simulated.Rotation;
+
+    if (Enabled.Has(ECameraHotFeature::IntelligentFraming))
     {
-        UpdateFocusBasedFOV();
+        UpdateIntelligentFraming(Input, Pose);
     }
 
-    if (bEnableAdvancedMotionBlur)
+    if (Enabled.Has(ECameraHotFeature::TerrainTilt))
     {
-        ApplyAdvancedMotionBlur();
+        UpdateBasedOnTerrain(Input, Pose);
     }
 
-    if (bEnableCameraInertia)
+    if (Enabled.Has(ECameraHotFeature::Recoil))
     {
-        ApplyCameraInertia(DeltaTime);
+        Pose.AddRotation(Simulated.RecoilRotation);
     }
 
-    if (bEnableHeadBobbing)
+    // 6. Additive effects
+    ApplyEffectTimeline(Input, Pose);
+
+    if (ShakeBank.IsActive())
+    {
+        Pose.AddRotation(ShakeBank.Evaluate(Input.DeltaTime));
+    }
+}
+
+FCameraFrameInput UCustomCameraComponent::GatherFrameInput(float DeltaTime) const
+{
+    FCameraFrameInput Input;
+    Input.DeltaTime = DeltaTime;
+    Input.WorldTime = GetWorld()->GetTimeSeconds();
+    Input.ParentTransform = GetAttachParent() ? GetAttachParent()->GetSocketTransform(GetAttachSocketName()) : FTransform::Identity;
+    Input.ComponentTransform = GetComponentTransform();
+    Input.OwnerLocation = GetOwner() ? GetOwner()->GetActorLocation() : Input.ParentTransform.GetLocation();
+    Input.OwnerViewLocation = Input.OwnerLocation;
+    Input.bIsAiming = bIsAiming;
+    Input.bIsRunning = bIsRunning;
+
+    if (CachedOwnerPawn)
+    {
+        Input.OwnerPawn = CachedOwnerPawn;
+        Input.MovementComponent = CachedOwnerPawn->GetMovementComponent();
+        Input.OwnerViewLocation = CachedOwnerPawn->GetPawnViewLocation();
+        Input.Velocity = CachedOwnerPawn->GetVelocity();
+        Input.Speed = Input.Velocity.Size();
+        Input.ControlRotation = CachedOwnerPawn->GetControlRotation();
+    }
+    return Input;
+}
+
+void UCustomCameraComponent::ConsumeFreeCameraInput(const FCameraFrameInput& Input)
+{
+    if (CameraMode == ECameraMode::FreeCamera && !PendingFreeCameraInput.IsZero())
+    {
+        // Move along the camera's own forward/right axes, expressed relative to the attach parent
+        FVector LocalMovement = FVector(PendingFreeCameraInput.Y, PendingFreeCameraInput.X, 0.0f) * Tuning->CameraLagSpeed * Input.DeltaTime;
+        FreeCameraLocation += CurrentRotation.RotateVector(LocalMovement);
+    }
+    PendingFreeCameraInput = FVector2D::ZeroVector;
+}
+
+FCameraModeContext UCustomCameraComponent::MakeModeContext(const FCameraFrameInput& Input) const
+{
+    FCameraModeContext Context(Input);
+    Context.LookRotation = CurrentRotation;
+    Context.DefaultFOV = Tuning->DefaultFOV;
+    Context.ThirdPersonLocation = Tuning->ThirdPersonPosition;
+    Context.FirstPersonLocation = Tuning->FirstPersonPosition;
+    Context.FreeCameraLocation = FreeCameraLocation;
+    Context.CinematicLocation = CinematicLocation;
+    Context.CinematicRotation = CinematicRotation;
+    Context.CinematicFOV = CinematicFOV;
+    return Context;
+}
+
+void UCustomCameraComponent::UpdateCinematicRail(const FCameraFrameInput& Input)
+{
+    if (CameraMode != ECameraMode::Cinematic || !CinematicRail)
+    {
+        return;
+    }
+
+    const FCameraRailTable& Table = CinematicRail->GetTable();
+    if (!Table.IsValid())
+    {
+        return;
+    }
+
+    CinematicRailDistance += CinematicRail->Speed * Tuning->CinematicRailPlayRate * Input.DeltaTime;
+    if (Table.IsClosedLoop())
+    {
+        CinematicRailDistance = FMath::Fmod(CinematicRailDistance, Table.GetLength());
+    }
+
+    // Rails are baked in world space; the mode stack works relative to the attach parent
+    const FCameraRailSample Sample = Table.Sample(CinematicRailDistance);
+    CinematicLocation = Input.ParentTransform.InverseTransformPosition(Sample.Location);
+    CinematicRotation = Input.ParentTransform.InverseTransformRotation(Sample.Rotation.Quaternion()).Rotator();
+    CinematicFOV = Sample.FieldOfView;
+}
+
+void UCustomCameraComponent::CommitPose(const FCameraFrameInput& Input, FCameraPoseAccumulator& Pose)
+{
+    Pose.ResolvePivotDistance(Input);
+    SetRelativeLocationAndRotation(Pose.Location, Pose.Rotation);
+    if (!FMath::IsNearlyEqual(FieldOfView, Pose.FieldOfView))
+    {
+        SetFieldOfView(Pose.FieldOfView);
+    }
+}
+
+void UCustomCameraComponent::RecordPose(const FCameraFrameInput& Input, const FCameraPoseAccumulator& Pose)
+{
+    if (!Tuning->bRecordPoses || !PoseRecorder.IsInitialized())
+    {
+        return;
+    }
+
+    FCameraRecordedPose Recorded;
+    Recorded.Location = Pose.GetWorldLocation(Input);
+    Recorded.Rotation = Input.ParentTransform.TransformRotation(Pose.Rotation.Quaternion()).Rotator();
+    Recorded.FieldOfView = Pose.FieldOfView;
+    for (int32 Layer = 0; Layer < FCameraPostProcessStack::NumLayers; ++Layer)
+    {
+        Recorded.LayerWeights[Layer] = PostProcessStack.GetLayerWeight(static_cast<ECameraPostProcessLayer>(Layer));
+    }
+    PoseRecorder.Record(Input.DeltaTime, Recorded);
+}
+
+void UCustomCameraComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    // Switched on in PreReplication only while someone is spectating this pawn
+    DOREPLIFETIME_CONDITION(UCustomCameraComponent, SpectatorPose, COND_Custom);
+}
+
+void UCustomCameraComponent::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+    Super::PreReplication(ChangedPropertyTracker);
+
+    DOREPLIFETIME_ACTIVE_OVERRIDE(UCustomCameraComponent, SpectatorPose, Tuning->bReplicateToSpectators && IsSpectatedRemotely());
+}
+
+bool UCustomCameraComponent::IsSpectatedRemotely() const
+{
+    const UWorld* World = GetWorld();
+    const AActor* Owner = GetOwner();
+    if (!World || !Owner)
+    {
+        return false;
+    }
+
+    // A listen server host gets the pose straight from ServerSendSpectatorPose
+    const AController* OwnerController = CachedOwnerPawn ? CachedOwnerPawn->GetController() : nullptr;
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PC = It->Get();
+        if (PC && PC != OwnerController && !PC->IsLocalController() && PC->GetViewTarget() == Owner)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool UCustomCameraComponent::IsLocalViewTarget() const
+{
+    const UWorld* World = GetWorld();
+    const APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+    return PC && PC->GetViewTarget() == GetOwner();
+}
+
+void UCustomCameraComponent::SendSpectatorPose(const FCameraFrameInput& Input, const FCameraPoseAccumulator& Pose)
+{
+    if (!Tuning->bReplicateToSpectators)
+    {
+        return;
+    }
+
+    FCameraSpectatorSendSettings Settings;
+    Settings.MinSendInterval = Tuning->SpectatorMinSendInterval;
+    Settings.MaxSendInterval = Tuning->SpectatorMaxSendInterval;
+    Settings.LocationThreshold = Tuning->SpectatorLocationThreshold;
+    Settings.RotationThreshold = Tuning->SpectatorRotationThreshold;
+    Settings.FOVThreshold = Tuning->SpectatorFOVThreshold;
+
+    FCameraSpectatorPose Current;
+    Current.Location = Pose.GetWorldLocation(Input);
+    Current.Rotation = Input.ParentTransform.TransformRotation(Pose.Rotation.Quaternion()).Rotator();
+    Current.FieldOfView = Pose.FieldOfView;
+
+    FCameraSpectatorPosePacket Packet;
+    if (!SpectatorSender.Update(Input.DeltaTime, Current, Settings, Packet))
+    {
+        return;
+    }
+
+    // A listen server host writes the replicated pose directly
+    if (GetOwnerRole() == ROLE_Authority)
+    {
+        SpectatorPose = Current;
+        SpectatorSender.Acknowledge(Packet.Sequence);
+    }
+    else
+    {
+        ServerSendSpectatorPose(Packet);
+    }
+}
+
+void UCustomCameraComponent::ServerSendSpectatorPose_Implementation(const FCameraSpectatorPosePacket& Packet)
+{
+    FCameraSpectatorPose Pose;
+    if (!SpectatorReceiver.Decode(Packet, Pose))
     {
-        ApplyHeadBobbing(DeltaTime, bIsRunning);
+        return;
     }
 
-    if (bEnableCameraSway)
+    SpectatorPose = Pose;
+    ClientAckSpectatorPose(Packet.Sequence);
+
+    // OnRep doesn't run on the server; a listen server host may be spectating this player
+    if (GetNetMode() == NM_ListenServer)
     {
-        ApplyCameraSway(DeltaTime);
+        ReceiveSpectatorPose();
     }
-    if (bEnableDynamicObjectTransparency)
+}
+
+void UCustomCameraComponent::ClientAckSpectatorPose_Implementation(uint8 Sequence)
+{
+    SpectatorSender.Acknowledge(Sequence);
+}
+
+void UCustomCameraComponent::OnRep_SpectatorPose()
+{
+    ReceiveSpectatorPose();
+}
+
+void UCustomCameraComponent::ReceiveSpectatorPose()
+{
+    UWorld* World = GetWorld();
+    if (!World)
     {
-        HandleDynamicObjectTransparency();
+        return;
     }
 
-    if (bEnableOverShoulderRepositioning)
+    // Poses are buffered regardless so a player who switches to this pawn starts from a full history
+    SpectatorInterpolator.Push(SpectatorPose, World->GetTimeSeconds(), Tuning->SpectatorMinSendInterval);
+    if (!bSpectatorViewRegistered && !bCameraUpdatesActive && IsLocalViewTarget())
     {
-        FVector TargetPosition = bIsAiming ? OverShoulderOffset : FVector::ZeroVector;
-        SetRelativeLocation(FMath::VInterpTo(GetRelativeLocation(), TargetPosition, DeltaTime, RepositioningSpeed));
+        if (UCustomCameraSubsystem* Subsystem = World->GetSubsystem<UCustomCameraSubsystem>())
+        {
+            Subsystem->RegisterSpectatorCamera(this);
+            bSpectatorViewRegistered = true;
+        }
     }
+}
 
-    if (bEnableRecoil)
+bool UCustomCameraComponent::UpdateSpectatorView(double WorldTime)
+{
+    // A camera the local player controls is driven by its own pipeline
+    if (bCameraUpdatesActive || !IsLocalViewTarget())
     {
-        ApplyRecoil(DeltaTime);
+        bSpectatorViewRegistered = false;
+        return false;
     }
 
-    if (bEnableEnvironmentalAwareness)
+    FCameraSpectatorPose Pose;
+    if (!SpectatorInterpolator.Sample(WorldTime - Tuning->SpectatorInterpolationDelay, Pose))
     {
-        UpdateEnvironmentalAwareness();
+        return true;
     }
 
-    if (bEnableFocusBasedFOV)
+    SetWorldLocationAndRotation(Pose.Location, Pose.Rotation);
+    if (!FMath::IsNearlyEqual(FieldOfView, Pose.FieldOfView))
     {
-        UpdateFocusBasedFOV();
+        SetFieldOfView(Pose.FieldOfView);
     }
+    return true;
+}
 
-    if (bEnableAdvancedMotionBlur)
+void UCustomCameraComponent::StartPoseReplay(UCustomCameraComponent* Source, float SecondsBack, float PlayRate)
+{
+    Source = Source ? Source : this;
+    const FCameraPoseRecorder& Recorder = Source->PoseRecorder;
+    if (Recorder.GetEndSerial() == 0)
+    {
+        return;
+    }
+
+    if (!bReplayingPoses)
+    {
+        for (int32 Layer = 0; Layer < FCameraPostProcessStack::NumLayers; ++Layer)
+        {
+            ReplaySavedLayerWeights[Layer] = PostProcessStack.GetLayerWeight(static_cast<ECameraPostProcessLayer>(Layer));
+        }
+    }
+
+    // The replay ends on the newest frame at the time it started, even if the source keeps recording
+    ReplaySource = Source;
+    ReplayEndSerial = static_cast<double>(Recorder.GetEndSerial() - 1);
+    ReplaySerial = FMath::Max(ReplayEndSerial - SecondsBack / Recorder.GetSampleInterval(), static_cast<double>(Recorder.GetFirstSerial()));
+    ReplayPlayRate = PlayRate;
+    bReplayingPoses = true;
+}
+
+void UCustomCameraComponent::StopPoseReplay()
+{
+    if (!bReplayingPoses)
     {
-        ApplyAdvancedMotionBlur();
+        return;
     }
 
-    if (bEnableCameraInertia)
+    bReplayingPoses = false;
+    ReplaySource = nullptr;
+    for (int32 Layer = 0; Layer < FCameraPostProcessStack::NumLayers; ++Layer)
     {
-        ApplyCameraInertia(DeltaTime);
+        PostProcessStack.SetLayerWeight(static_cast<ECameraPostProcessLayer>(Layer), ReplaySavedLayerWeights[Layer]);
     }
 }
 
+void UCustomCameraComponent::ApplyPoseReplay(const FCameraFrameInput& Input)
+{
+    FCameraRecordedPose Recorded;
+    if (!IsValid(ReplaySource) || ReplaySerial > ReplayEndSerial || !ReplaySource->PoseRecorder.Sample(ReplaySerial, Recorded))
+    {
+        StopPoseReplay();
+        return;
+    }
+    ReplaySerial += Input.DeltaTime * ReplayPlayRate / ReplaySource->PoseRecorder.GetSampleInterval();
+
+    SetWorldLocationAndRotation(Recorded.Location, Recorded.Rotation);
+    if (!FMath::IsNearlyEqual(FieldOfView, Recorded.FieldOfView))
+    {
+        SetFieldOfView(Recorded.FieldOfView);
+    }
+
+    for (int32 Layer = 0; Layer < FCameraPostProcessStack::NumLayers; ++Layer)
+    {
+        PostProcessStack.SetLayerWeight(static_cast<ECameraPostProcessLayer>(Layer), Recorded.LayerWeights[Layer]);
+    }
+    PostProcessStack.Push(PostProcessSettings);
+}
+
+template<typename TFeatures>
+void UCustomCameraComponent::UpdateFrameEffects(const FCameraFrameInput& Input, TFeatures Enabled)
+{
+    ApplyEffectPostProcess();
+
+    const bool bAdaptiveDepthOfField = Enabled.Has(ECameraHotFeature::AdaptiveDepthOfField);
+    PostProcessStack.SetLayerWeight(ECameraPostProcessLayer::DepthOfField, bAdaptiveDepthOfField ? 1.0f : 0.0f);
+    if (bAdaptiveDepthOfField)
+    {
+        UpdateAdaptiveDepthOfField(Input);
+    }
+
+    const bool bMotionBlur = Enabled.Has(ECameraHotFeature::MotionBlur);
+    PostProcessStack.SetLayerWeight(ECameraPostProcessLayer::MotionBlur, bMotionBlur ? 1.0f : 0.0f);
+    if (bMotionBlur)
+    {
+        ApplyAdvancedMotionBlur(Input);
+    }
+
+    if (Enabled.Has(ECameraHotFeature::ObjectTransparency))
+    {
+        HandleDynamicObjectTransparency(Input);
+    }
+
+    // Only the fields that changed this frame reach the camera's settings
+    PostProcessStack.Push(PostProcessSettings);
+}
+
 void UCustomCameraComponent::SetCameraMode(ECameraMode NewMode)
 {
     if (CameraMode != NewMode)
@@ -278,36 +917,63 @@ ECameraMode UCustomCameraComponent::GetCameraMode() const
 
 void UCustomCameraComponent::SwitchToFirstPerson()
 {
-    SmoothTransitionToTarget(FirstPersonPosition, DefaultFOV, TransitionSpeed);
+    CameraMode = ECameraMode::FirstPerson;
+    ++BasePoseSerial;
+    ModeStack.Push(ECameraMode::FirstPerson, Tuning->ModeBlendTime, Tuning->ModeBlendOption);
     bIsFirstPersonMode = true;
 }
 
 void UCustomCameraComponent::SwitchToThirdPerson()
 {
-    SmoothTransitionToTarget(ThirdPersonPosition, DefaultFOV, TransitionSpeed);
+    CameraMode = ECameraMode::ThirdPerson;
+    ++BasePoseSerial;
+    ModeStack.Push(ECameraMode::ThirdPerson, Tuning->ModeBlendTime, Tuning->ModeBlendOption);
     bIsFirstPersonMode = false;
 }
 
 void UCustomCameraComponent::SwitchToFreeCamera()
 {
-    UE_LOG(LogTemp, Log, TEXT("Switched to Free Camera Mode"));
+    // The free camera starts where the camera is and moves from there
+    CameraMode = ECameraMode::FreeCamera;
+    FreeCameraLocation = GetRelativeLocation();
+    ++BasePoseSerial;
+    ModeStack.Push(ECameraMode::FreeCamera, Tuning->ModeBlendTime, Tuning->ModeBlendOption);
+    bIsFirstPersonMode = false;
 }
 
 void UCustomCameraComponent::SwitchToCinematic()
 {
-    UE_LOG(LogTemp, Log, TEXT("Switched to Cinematic Mode"));
+    // Without a rail, hold the current shot
+    CameraMode = ECameraMode::Cinematic;
+    if (!CinematicRail)
+    {
+        CinematicLocation = GetRelativeLocation();
+        CinematicRotation = GetRelativeRotation();
+        CinematicFOV = FieldOfView;
+    }
+    ++BasePoseSerial;
+    ModeStack.Push(ECameraMode::Cinematic, Tuning->ModeBlendTime, Tuning->ModeBlendOption);
+    bIsFirstPersonMode = false;
+}
+
+void UCustomCameraComponent::PlayCinematicRail(ACameraRailActor* Rail, float StartDistance)
+{
+    CinematicRail = Rail;
+    CinematicRailDistance = StartDistance;
+    if (CameraMode != ECameraMode::Cinematic)
+    {
+        SetCameraMode(ECameraMode::Cinematic);
+    }
 }
 
 void UCustomCameraComponent::StartAiming()
 {
     bIsAiming = true;
-    AdjustCameraFOV(GetWorld()->GetDeltaSeconds(), AimingFOV);
 }
 
 void UCustomCameraComponent::StopAiming()
 {
     bIsAiming = false;
-    AdjustCameraFOV(GetWorld()->GetDeltaSeconds(), DefaultFOV);
 }
 
 void UCustomCameraComponent::StartRunning()
@@ -322,29 +988,22 @@ void UCustomCameraComponent::StopRunning()
 
 void UCustomCameraComponent::Look(float AxisValueX, float AxisValueY)
 {
-    CurrentRotation.Yaw += AxisValueX * RotationSpeed;
-    CurrentRotation.Pitch = FMath::Clamp(CurrentRotation.Pitch + AxisValueY * RotationSpeed, -MaxPitchRotation, MaxPitchRotation);
+    CurrentRotation.Yaw += AxisValueX * Tuning->RotationSpeed;
+    CurrentRotation.Pitch = FMath::Clamp(CurrentRotation.Pitch + AxisValueY * Tuning->RotationSpeed, -Tuning->MaxPitchRotation, Tuning->MaxPitchRotation);
     ClampRotation(CurrentRotation);
-    SetRelativeRotation(CurrentRotation);
 }
 
 void UCustomCameraComponent::Move(float AxisValueX, float AxisValueY)
 {
     if (CameraMode == ECameraMode::FreeCamera)
     {
-        FVector Forward = GetForwardVector();
-        FVector Right = GetRightVector();
-        FVector Movement = (Forward * AxisValueY + Right * AxisValueX) * CameraLagSpeed * GetWorld()->GetDeltaSeconds();
-        AddRelativeLocation(Movement, true);
+        // Applied on the next camera update, which owns the frame's delta time
+        PendingFreeCameraInput += FVector2D(AxisValueX, AxisValueY);
     }
-    else
+    else if (CachedOwnerPawn && CachedOwnerPawn->IsLocallyControlled())
     {
-        APawn* OwnerPawn = Cast<APawn>(GetOwner());
-        if (OwnerPawn && OwnerPawn->IsLocallyControlled())
-        {
-            OwnerPawn->AddMovementInput(OwnerPawn->GetActorForwardVector(), AxisValueY);
-            OwnerPawn->AddMovementInput(OwnerPawn->GetActorRightVector(), AxisValueX);
-        }
+        CachedOwnerPawn->AddMovementInput(CachedOwnerPawn->GetActorForwardVector(), AxisValueY);
+        CachedOwnerPawn->AddMovementInput(CachedOwnerPawn->GetActorRightVector(), AxisValueX);
     }
 }
 
@@ -370,556 +1029,595 @@ void UCustomCameraComponent::MoveY(float AxisValue)
 
 void UCustomCameraComponent::ApplyFadeEffect(float Duration)
 {
-    if (PostProcessVolume && FadeMaterial)
+    if (Tuning->FadeMaterial)
     {
         if (FadeMaterialInstance)
         {
-            PostProcessVolume->Settings.RemoveBlendable(FadeMaterialInstance);
-            FadeMaterialInstance->ConditionalBeginDestroy();
+            MaterialInstancePool.Release(FadeMaterialInstance);
             FadeMaterialInstance = nullptr;
         }
 
-        FadeMaterialInstance = UMaterialInstanceDynamic::Create(FadeMaterial, this);
+        FadeMaterialInstance = MaterialInstancePool.Acquire(Tuning->FadeMaterial, this);
         FadeMaterialInstance->SetScalarParameterValue(FName("FadeAmount"), 0.0f);
-        PostProcessVolume->Settings.AddBlendable(FadeMaterialInstance, 1.0f);
+        PostProcessStack.SetBlendable(ECameraPostProcessLayer::Fade, FadeMaterialInstance);
+        PostProcessStack.SetLayerWeight(ECameraPostProcessLayer::Fade, 1.0f);
 
-        UPostProcessComponent* PPComponent = Cast<UPostProcessComponent>(PostProcessVolume->GetComponentByClass(UPostProcessComponent::StaticClass()));
-        if (PPComponent)
-        {
-            PPComponent->AddOrUpdateBlendable(FadeMaterialInstance);
-        }
-
-        FTimerDelegate FadeDelegate;
-        FadeDelegate.BindLambda([DynMaterial = FadeMaterialInstance, Duration, this]()
-            {
-                if (!DynMaterial) return;
-                float DeltaTime = GetWorld()->GetDeltaSeconds();
-                float CurrentFade = 0.0f;
-                DynMaterial->GetScalarParameterValue(FName("FadeAmount"), CurrentFade);
-                float Alpha = FMath::Clamp(CurrentFade + (DeltaTime / Duration), 0.0f, 1.0f);
-                DynMaterial->SetScalarParameterValue(FName("FadeAmount"), Alpha);
-                if (Alpha >= 1.0f)
-                {
-                    GetWorld()->GetTimerManager().ClearTimer(FadeInterpolationHandle);
-                }
-            });
-
-        GetWorld()->GetTimerManager().SetTimer(FadeInterpolationHandle, FadeDelegate, 0.01f, true);
+        // Restart the fade on the timeline; it holds at full fade until the next ApplyFadeEffect
+        EffectTimeline.StopChannel(ECameraEffectChannel::FadeAmount);
+        EffectTimeline.Play(ECameraEffectChannel::FadeAmount, GetWorld()->GetTimeSeconds(), Duration, 1.0f, Tuning->FadeCurve, true);
     }
 }
 
 void UCustomCameraComponent::ApplyOcclusionEffect()
 {
-    if (PostProcessVolume && OcclusionMaterial)
+    if (Tuning->OcclusionMaterial)
     {
         if (OcclusionMaterialInstance)
         {
-            UPostProcessComponent* PPComponent = Cast<UPostProcessComponent>(PostProcessVolume->GetComponentByClass(UPostProcessComponent::StaticClass()));
-            if (PPComponent)
-            {
-                PPComponent->Settings.RemoveBlendable(OcclusionMaterialInstance);
-            }
-            OcclusionMaterialInstance->ConditionalBeginDestroy();
+            MaterialInstancePool.Release(OcclusionMaterialInstance);
             OcclusionMaterialInstance = nullptr;
         }
 
-        OcclusionMaterialInstance = UMaterialInstanceDynamic::Create(OcclusionMaterial, this);
+        OcclusionMaterialInstance = MaterialInstancePool.Acquire(Tuning->OcclusionMaterial, this);
         OcclusionMaterialInstance->SetScalarParameterValue(FName("OcclusionIntensity"), 1.0f);
-
-        UPostProcessComponent* PPComponent = Cast<UPostProcessComponent>(PostProcessVolume->GetComponentByClass(UPostProcessComponent::StaticClass()));
-        if (PPComponent)
-        {
-            PPComponent->AddOrUpdateBlendable(OcclusionMaterialInstance);
-        }
+        PostProcessStack.SetBlendable(ECameraPostProcessLayer::Occlusion, OcclusionMaterialInstance);
+        PostProcessStack.SetLayerWeight(ECameraPostProcessLayer::Occlusion, 1.0f);
     }
 }
 
 void UCustomCameraComponent::RemoveOcclusionEffect()
 {
-    if (PostProcessVolume && OcclusionMaterialInstance)
+    if (OcclusionMaterialInstance)
     {
-        PostProcessVolume->Settings.RemoveBlendable(OcclusionMaterialInstance);
-        OcclusionMaterialInstance->ConditionalBeginDestroy();
+        PostProcessStack.SetBlendable(ECameraPostProcessLayer::Occlusion, nullptr);
+        PostProcessStack.SetLayerWeight(ECameraPostProcessLayer::Occlusion, 0.0f);
+        MaterialInstancePool.Release(OcclusionMaterialInstance);
         OcclusionMaterialInstance = nullptr;
     }
 }
 
 void UCustomCameraComponent::ApplyDepthOfField()
 {
-    if (PostProcessVolume)
-    {
-        PostProcessVolume->Settings.DepthOfFieldFocalDistance = DepthOfField;
-        PostProcessVolume->Settings.DepthOfFieldFocalRegion = 10.0f;
-        PostProcessVolume->Settings.DepthOfFieldFstop = FMath::Clamp(FocusDistance / 1000.0f, 1.0f, 16.0f);
-    }
+    PostProcessStack.SetField(ECameraPostProcessLayer::Base, ECameraPostProcessField::DepthOfFieldFocalDistance, Tuning->DepthOfField);
+    PostProcessStack.SetField(ECameraPostProcessLayer::Base, ECameraPostProcessField::DepthOfFieldFocalRegion, 10.0f);
+    PostProcessStack.SetField(ECameraPostProcessLayer::Base, ECameraPostProcessField::DepthOfFieldFstop, FMath::Clamp(Tuning->FocusDistance / 1000.0f, 1.0f, 16.0f));
 }
 
 void UCustomCameraComponent::ApplyMotionBlur()
 {
-    if (PostProcessVolume)
-    {
-        PostProcessVolume->Settings.MotionBlurAmount = MotionBlurAmount;
-    }
+    PostProcessStack.SetField(ECameraPostProcessLayer::Base, ECameraPostProcessField::MotionBlurAmount, Tuning->MotionBlurAmount);
 }
 
 void UCustomCameraComponent::ApplyColorGrading()
 {
-    if (PostProcessVolume)
-    {
-        PostProcessVolume->Settings.ColorGradingIntensity = ColorGradingIntensity;
-    }
+    PostProcessStack.SetField(ECameraPostProcessLayer::Base, ECameraPostProcessField::ColorGradingIntensity, Tuning->ColorGradingIntensity);
 }
 
 void UCustomCameraComponent::ApplyVignette()
 {
-    if (PostProcessVolume)
-    {
-        PostProcessVolume->Settings.VignetteIntensity = VignetteIntensity;
-    }
+    PostProcessStack.SetField(ECameraPostProcessLayer::Base, ECameraPostProcessField::VignetteIntensity, Tuning->VignetteIntensity);
 }
 
 void UCustomCameraComponent::TriggerCameraShake(TSubclassOf<UCameraShakeBase> ShakeClassParam, float Scale)
 {
-    if (ShakeClassParam)
+    // Only the owning player's camera manager; PlayWorldCameraShake would visit every player controller
+    APlayerController* PC = CachedOwnerPawn ? Cast<APlayerController>(CachedOwnerPawn->GetController()) : nullptr;
+    if (ShakeClassParam && PC && PC->PlayerCameraManager)
     {
-        UGameplayStatics::PlayWorldCameraShake(GetWorld(), ShakeClassParam, GetOwner()->GetActorLocation(), 0.0f, 0.0f, Scale);
+        PC->PlayerCameraManager->StartCameraShake(ShakeClassParam, Scale);
     }
 }
 
 void UCustomCameraComponent::TriggerCameraShakeAction(ECameraShakeAction Action)
 {
-    for (const FCameraShakeMapping& Mapping : CameraShakeMappings)
+    // Table lookup and a free oscillator lane; nothing is allocated per trigger
+    if (bCameraUpdatesActive)
     {
-        if (Mapping.Action == Action)
-        {
-            TriggerCameraShake(CameraShakeClass, Mapping.ShakeParams.Intensity);
-            break;
-        }
+        ShakeBank.PlayAction(Action);
     }
 }
 
-void UCustomCameraComponent::SmoothTransitionToTarget(FVector TargetPosition, float TargetFOV, float Duration)
+bool UCustomCameraComponent::AddFramingTarget(AActor* Target, float Radius)
 {
-    bIsTransitioning = true;
-    TransitionElapsedTime = 0.0f;
-    TransitionTotalDuration = Duration;
-    TransitionStartPosition = GetRelativeLocation();
-    TransitionTargetPosition = TargetPosition;
-    TransitionStartFOV = FieldOfView;
-    TransitionTargetFOV = TargetFOV;
+    return FramingTargets.Add(Target, Radius);
 }
 
-void UCustomCameraComponent::InstantTransitionToTarget(FVector TargetPosition, float TargetFOV)
+bool UCustomCameraComponent::RemoveFramingTarget(AActor* Target)
 {
-    SetRelativeLocation(TargetPosition);
-    SetFieldOfView(TargetFOV);
-    bIsTransitioning = false;
+    return FramingTargets.Remove(Target);
 }
 
-void UCustomCameraComponent::BeginWarpEffect()
+void UCustomCameraComponent::ClearFramingTargets()
 {
-    if (WarpSoundEffect)
-    {
-        // Play the warp sound at the camera's location without needing an attached audio component.
-        UGameplayStatics::PlaySoundAtLocation(GetWorld(), WarpSoundEffect, GetComponentLocation(), WarpSoundVolumeMultiplier, WarpSoundPitchMultiplier);
-    }
-
-    OriginalFOV = FieldOfView;
-    WarpStartFOV = OriginalFOV;
-    WarpEndFOV = OriginalFOV + WarpMaxFOVIncrease;
-    WarpElapsedTime = 0.0f;
-    WarpTotalDuration = WarpDuration;
-
-    GetWorld()->GetTimerManager().SetTimer(WarpTimerHandle, this, &UCustomCameraComponent::UpdateWarpEffect, 0.01f, true);
+    FramingTargets.Reset();
 }
 
-void UCustomCameraComponent::PerformDynamicZoom()
+void UCustomCameraComponent::InvalidateProbeCache()
 {
-    APawn* OwnerPawn = Cast<APawn>(GetOwner());
-    if (!OwnerPawn) return;
-
-    float Speed = OwnerPawn->GetVelocity().Size();
-    if (Speed > DynamicZoomThreshold)
-    {
-        float TargetFOV = FMath::FInterpTo(FieldOfView, ZoomedFOV, GetWorld()->GetDeltaSeconds(), DynamicZoomSpeed);
-        SetFieldOfView(TargetFOV);
-    }
-    else
-    {
-        float TargetFOV = FMath::FInterpTo(FieldOfView, DefaultFOV, GetWorld()->GetDeltaSeconds(), DynamicZoomSpeed);
-        SetFieldOfView(TargetFOV);
-    }
+    CollisionProbeCache.Invalidate();
+    PredictionProbeCache.Invalidate();
 }
 
-void UCustomCameraComponent::UpdateContextualPositioning()
+void UCustomCameraComponent::SmoothTransitionToTarget(FVector TargetPosition, float TargetFOV, float Duration)
 {
-    // Implementation based on game context
+    ++BasePoseSerial;
+    ModeStack.PushAnchored(CameraMode, TargetPosition, TargetFOV, Duration, Tuning->ModeBlendOption);
 }
 
-void UCustomCameraComponent::UpdateIntelligentFraming()
+void UCustomCameraComponent::InstantTransitionToTarget(FVector TargetPosition, float TargetFOV)
 {
-    APawn* OwnerPawn = Cast<APawn>(GetOwner());
-    if (OwnerPawn)
-    {
-        FVector PlayerLocation = OwnerPawn->GetActorLocation();
-        FVector CameraLocation = GetComponentLocation();
-        FVector Direction = (PlayerLocation - CameraLocation).GetSafeNormal();
-        FRotator TargetRotation = Direction.Rotation();
-        SetRelativeRotation(FMath::RInterpTo(GetRelativeRotation(), TargetRotation, GetWorld()->GetDeltaSeconds(), RotationSpeed));
-    }
+    ++BasePoseSerial;
+    ModeStack.PushAnchored(CameraMode, TargetPosition, TargetFOV, 0.0f, Tuning->ModeBlendOption);
 }
 
-void UCustomCameraComponent::UpdateAdaptiveDepthOfField()
+void UCustomCameraComponent::BeginWarpEffect()
 {
-    if (PostProcessVolume)
+    if (Tuning->WarpSoundEffect)
     {
-        PostProcessVolume->Settings.DepthOfFieldFocalDistance = FocusDistance;
-        PostProcessVolume->Settings.DepthOfFieldFocalRegion = 10.0f;
-        PostProcessVolume->Settings.DepthOfFieldFstop = FMath::Clamp(FocusDistance / 1000.0f, 1.0f, 16.0f);
+        // Play the warp sound at the camera's location without needing an attached audio component.
+        UGameplayStatics::PlaySoundAtLocation(GetWorld(), Tuning->WarpSoundEffect, GetComponentLocation(), Tuning->WarpSoundVolumeMultiplier, Tuning->WarpSoundPitchMultiplier);
     }
+
+    const float StartTime = GetWorld()->GetTimeSeconds();
+    EffectTimeline.StopChannel(ECameraEffectChannel::FOVOffset);
+    EffectTimeline.StopChannel(ECameraEffectChannel::Vignette);
+    EffectTimeline.StopChannel(ECameraEffectChannel::MotionBlur);
+    // Without a curve each channel pulses up and back down so nothing snaps off when the effect ends
+    EffectTimeline.Play(ECameraEffectChannel::FOVOffset, StartTime, Tuning->WarpDuration, Tuning->WarpMaxFOVIncrease, Tuning->WarpCurve, false, ECameraEffectShape::Pulse);
+    EffectTimeline.Play(ECameraEffectChannel::Vignette, StartTime, Tuning->WarpDuration, Tuning->WarpVignetteIntensity, Tuning->WarpCurve, false, ECameraEffectShape::Pulse);
+    EffectTimeline.Play(ECameraEffectChannel::MotionBlur, StartTime, Tuning->WarpDuration, Tuning->WarpMotionBlurAmount, Tuning->WarpCurve, false, ECameraEffectShape::Pulse);
 }
 
-void UCustomCameraComponent::PredictAndPreventCollisions()
+void UCustomCameraComponent::UpdateContextualPositioning(const FCameraFrameInput& Input, FCameraPoseAccumulator& Pose)
 {
-    APawn* OwnerPawn = Cast<APawn>(GetOwner());
-    if (!OwnerPawn) return;
-
-    FVector FutureLocation = OwnerPawn->GetActorLocation() + OwnerPawn->GetVelocity() * 0.5f;
-    FVector Start = GetComponentLocation();
-    FVector End = FutureLocation;
-    FHitResult HitResult;
-    FCollisionQueryParams Params;
-    Params.AddIgnoredActor(GetOwner());
-
-    if (GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_Camera, Params))
+    // A hash lookup in the subsystem's hint grid; no scene query
+    const ACameraHintVolume* Hint = CameraSubsystem && Input.OwnerPawn ? CameraSubsystem->FindCameraHint(Input.OwnerLocation) : nullptr;
+    ActiveHint = Hint;
+
+    // Blending out of a hint uses that hint's speeds
+    FVector TargetOffset = FVector::ZeroVector;
+    float TargetFOVDelta = 0.0f;
+    bool bLag = false;
+    if (Hint)
     {
-        FVector PushBack = (Start - HitResult.ImpactPoint).GetSafeNormal() * 50.0f;
-        SetRelativeLocation(GetRelativeLocation() + PushBack);
+        KRYO_DEBUG_STRING(GetWorld(), EKryoDebugCategory::Camera, Input.OwnerLocation, FString::Printf(TEXT("Camera hint: %s"), *Hint->GetName()), FColor::Cyan);
+        const FCameraHintSettings& Settings = Hint->Settings;
+        HintBlendSpeed = Settings.BlendSpeed;
+        TargetOffset = Settings.bOverrideOffset ? Settings.Offset : FVector::ZeroVector;
+        TargetFOVDelta = Settings.bOverrideFieldOfView ? Settings.FieldOfView - Pose.FieldOfView : 0.0f;
+        bLag = Settings.bOverrideLagSpeed;
+        if (bLag)
+        {
+            HintLagSpeed = Settings.LagSpeed;
+        }
     }
 
-    DrawDebugLine(GetWorld(), Start, End, FColor::Red, false, 1.0f, 0, 1.0f);
-}
-
-void UCustomCameraComponent::UpdateFocusBasedFOV()
-{
-    APawn* OwnerPawn = Cast<APawn>(GetOwner());
-    if (!OwnerPawn) return;
+    const float HalfLife = CameraSpring::HalfLifeFromSpeed(HintBlendSpeed);
+    CameraSpring::CriticallyDamped(HintOffset, HintOffsetVelocity, TargetOffset, HalfLife, Input.DeltaTime);
+    CameraSpring::CriticallyDamped(HintFOVDelta, HintFOVDeltaVelocity, TargetFOVDelta, HalfLife, Input.DeltaTime);
+    CameraSpring::CriticallyDamped(HintLagWeight, HintLagWeightVelocity, bLag ? 1.0f : 0.0f, HalfLife, Input.DeltaTime);
+    HintLagWeight = FMath::Clamp(HintLagWeight, 0.0f, 1.0f);
 
-    FVector CameraLocation = GetComponentLocation();
-    FVector FocusPoint = CameraLocation + GetForwardVector() * FocusDistance;
-    float Distance = FVector::Dist(CameraLocation, FocusPoint);
-    float DesiredFOV = FMath::Clamp(Distance / 10.0f, 60.0f, 90.0f);
-    AdjustCameraFOV(GetWorld()->GetDeltaSeconds(), DesiredFOV);
-}
+    Pose.AddLocalOffset(Pose.Rotation.RotateVector(HintOffset));
+    Pose.AddFieldOfView(HintFOVDelta);
 
-void UCustomCameraComponent::ApplyAdvancedMotionBlur()
-{
-    if (PostProcessVolume)
+    // The trailing location follows the pose at all times so a lag override blends in from where the camera is
+    const FVector WorldLocation = Pose.GetWorldLocation(Input);
+    if (!bHintLagValid || HintLagWeight <= UE_KINDA_SMALL_NUMBER)
     {
-        // Use owner pawn velocity to determine intensity
-        APawn* OwnerPawn = Cast<APawn>(GetOwner());
-        float VelocitySize = OwnerPawn ? OwnerPawn->GetVelocity().Size() : 0.0f;
-        float MotionBlurIntensity = FMath::Clamp(VelocitySize / 1000.0f, 0.0f, 1.0f) * MotionBlurIntensityMultiplier;
-        PostProcessVolume->Settings.MotionBlurAmount = MotionBlurIntensity;
+        HintLagLocation = WorldLocation;
+        HintLagVelocity = FVector::ZeroVector;
+        bHintLagValid = true;
+        return;
     }
+
+    CameraSpring::CriticallyDamped(HintLagLocation, HintLagVelocity, WorldLocation, CameraSpring::HalfLifeFromSpeed(HintLagSpeed), Input.DeltaTime);
+    Pose.AddWorldOffset(Input, (HintLagLocation - WorldLocation) * HintLagWeight);
 }
 
-void UCustomCameraComponent::UpdateWarpEffect()
+void UCustomCameraComponent::UpdateIntelligentFraming(const FCameraFrameInput& Input, FCameraPoseAccumulator& Pose)
 {
-    WarpElapsedTime += GetWorld()->GetDeltaSeconds();
-    float Alpha = FMath::Clamp(WarpElapsedTime / WarpTotalDuration, 0.0f, 1.0f);
-    float NewFOV = FMath::Lerp(WarpStartFOV, WarpEndFOV, Alpha);
-    SetFieldOfView(NewFOV);
-
-    if (PostProcessVolume)
+    const bool bHasTargets = FramingTargets.Num() > 0 && FramingTargets.Gather(Tuning->bFrameOwner && Input.OwnerPawn, Input.OwnerLocation, Tuning->FramingOwnerRadius) > 0;
+    if (bHasTargets || FramingWeight > UE_KINDA_SMALL_NUMBER)
     {
-        PostProcessVolume->Settings.VignetteIntensity = FMath::Lerp(0.0f, WarpVignetteIntensity, Alpha);
-        PostProcessVolume->Settings.MotionBlurAmount = FMath::Lerp(0.0f, WarpMotionBlurAmount, Alpha);
-    }
+        // The player keeps control of the view direction; the camera backs off along it to fit the group
+        const FQuat ViewRotation = Input.ParentTransform.TransformRotation(Pose.Rotation.Quaternion());
+        const float HalfLife = CameraSpring::HalfLifeFromSpeed(Tuning->FramingSpeed);
+
+        FCameraFramingSettings Settings;
+        Settings.MinDistance = Tuning->FramingMinDistance;
+        Settings.MaxDistance = Tuning->FramingMaxDistance;
+        Settings.MaxFieldOfView = Tuning->FramingMaxFOV;
+        Settings.ScreenMargin = Tuning->FramingScreenMargin;
+
+        FCameraFramingSolution Solution;
+        if (bHasTargets && FramingTargets.Solve(ViewRotation, Pose.FieldOfView, AspectRatio, Settings, Solution))
+        {
+            // Start from the unframed pose so engaging blends in rather than jumping
+            if (FramingWeight <= UE_KINDA_SMALL_NUMBER)
+            {
+                FramingCenter = Solution.Center;
+                FramingCenterVelocity = FVector::ZeroVector;
+                FramingDistance = FVector::Dist(Pose.GetWorldLocation(Input), Solution.Center);
+                FramingDistanceVelocity = 0.0f;
+                FramingFOV = Pose.FieldOfView;
+                FramingFOVVelocity = 0.0f;
+                FramingSafeDistance = -1.0f;
+            }
 
-    DrawDebugString(GetWorld(), GetComponentLocation(), FString::Printf(TEXT("Warp Effect: %.2f%%"), Alpha * 100.0f), nullptr, FColor::Yellow, 0.01f);
+            CameraSpring::CriticallyDamped(FramingCenter, FramingCenterVelocity, Solution.Center, HalfLife, Input.DeltaTime);
+            CameraSpring::CriticallyDamped(FramingDistance, FramingDistanceVelocity, Solution.Distance, HalfLife, Input.DeltaTime);
+            CameraSpring::CriticallyDamped(FramingFOV, FramingFOVVelocity, Solution.FieldOfView, HalfLife, Input.DeltaTime);
+        }
 
-    if (WarpElapsedTime >= WarpTotalDuration)
-    {
-        WarpElapsedTime = 0.0f;
-        WarpStartFOV = WarpEndFOV;
-        WarpEndFOV = OriginalFOV;
+        CameraSpring::CriticallyDamped(FramingWeight, FramingWeightVelocity, bHasTargets ? 1.0f : 0.0f, HalfLife, Input.DeltaTime);
+        FramingWeight = FMath::Clamp(FramingWeight, 0.0f, 1.0f);
 
-        if (PostProcessVolume)
+        const FVector FramedLocation = Input.ParentTransform.InverseTransformPosition(FramingCenter - ViewRotation.GetForwardVector() * FramingDistance);
+        Pose.Location = FMath::Lerp(Pose.Location, FramedLocation, FramingWeight);
+        Pose.FieldOfView = FMath::Lerp(Pose.FieldOfView, FramingFOV, FramingWeight);
+
+        // Framing runs after the collision stage and can back the camera far out, so the framed boom is swept on its own
+        const FVector Pivot = Input.OwnerViewLocation;
+        if (const FCameraProbeResult* Result = QueryBatcher.GetResult(ECameraProbe::Framing))
         {
-            PostProcessVolume->Settings.VignetteIntensity = 0.0f;
-            PostProcessVolume->Settings.MotionBlurAmount = 0.0f;
+            // A pivot already inside geometry says nothing about the boom; keep the last safe distance
+            if (!Result->Hit.bStartPenetrating)
+            {
+                FramingSafeDistance = Result->bBlockingHit ? Result->Hit.Distance : -1.0f;
+            }
         }
+        QueryBatcher.RequestSweep(ECameraProbe::Framing, Pivot, Pose.GetWorldLocation(Input), FCollisionShape::MakeSphere(FramingProbeRadius), ECC_Camera);
 
-        if (WarpAudioComponent->IsPlaying())
+        if (FramingSafeDistance >= 0.0f)
         {
-            WarpAudioComponent->Stop();
+            Pose.ClampPivotDistance(Pivot, FramingSafeDistance);
         }
 
-        GetWorld()->GetTimerManager().ClearTimer(WarpTimerHandle);
+        FramingRotation = Pose.Rotation;
+        FramingVelocity = FRotator::ZeroRotator;
+        return;
+    }
+
+    if (Input.OwnerPawn)
+    {
+        FVector CameraLocation = Pose.GetWorldLocation(Input);
+        FVector Direction = Input.ParentTransform.InverseTransformVectorNoScale(Input.OwnerLocation - CameraLocation).GetSafeNormal();
+        FRotator TargetRotation = Direction.Rotation();
+        CameraSpring::CriticallyDamped(FramingRotation, FramingVelocity, TargetRotation, CameraSpring::HalfLifeFromSpeed(Tuning->RotationSpeed), Input.DeltaTime);
+        Pose.Rotation = FramingRotation;
     }
 }
 
-void UCustomCameraComponent::PerformDynamicObstacleDetection()
+void UCustomCameraComponent::UpdateAdaptiveDepthOfField(const FCameraFrameInput& Input)
 {
-    FVector Start = GetComponentLocation();
-    FVector ForwardVector = GetForwardVector();
-    FVector End = Start + ForwardVector * 100.0f;
-    FHitResult HitResult;
-    FCollisionQueryParams Params;
-    Params.AddIgnoredActor(GetOwner());
+    const float Focus = Tuning->bEnableAutofocus ? UpdateAutofocus(Input) : Tuning->FocusDistance;
 
-    if (GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_Camera, Params))
+    // Small focus changes are invisible, so most frames leave the layer (and the post-process push) alone
+    if (AppliedFocusDistance >= 0.0f && FMath::Abs(Focus - AppliedFocusDistance) <= AppliedFocusDistance * Tuning->AutofocusUpdateThreshold)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Obstacle Detected: %s"), HitResult.GetActor() ? *HitResult.GetActor()->GetName() : TEXT("None"));
+        return;
+    }
+    AppliedFocusDistance = Focus;
+
+    PostProcessStack.SetField(ECameraPostProcessLayer::DepthOfField, ECameraPostProcessField::DepthOfFieldFocalDistance, Focus);
+    PostProcessStack.SetField(ECameraPostProcessLayer::DepthOfField, ECameraPostProcessField::DepthOfFieldFocalRegion, 10.0f);
+    PostProcessStack.SetField(ECameraPostProcessLayer::DepthOfField, ECameraPostProcessField::DepthOfFieldFstop, FMath::Clamp(Focus / 1000.0f, 1.0f, 16.0f));
+}
+
+float UCustomCameraComponent::UpdateAutofocus(const FCameraFrameInput& Input)
+{
+    const int32 NumRays = FMath::Clamp(Tuning->AutofocusRayCount, 1, 8);
 
-        float PushDistance = (HitResult.ImpactPoint - Start).Size() - 50.0f;
-        if (PushDistance < 0.0f)
+    // Last frame's rays: the nearest hit is the subject
+    bool bAnyResult = false;
+    float Nearest = Tuning->AutofocusMaxDistance;
+    for (int32 Ray = 0; Ray < NumRays; ++Ray)
+    {
+        if (const FCameraProbeResult* Result = QueryBatcher.GetResult(ECameraProbe::Autofocus, Ray))
         {
-            PushDistance = 0.0f;
+            bAnyResult = true;
+            if (Result->bBlockingHit)
+            {
+                Nearest = FMath::Min(Nearest, Result->Hit.Distance);
+            }
         }
-        FVector NewLocation = Start + ForwardVector * PushDistance;
-        SetRelativeLocation(NewLocation);
     }
 
-    DrawDebugLine(GetWorld(), Start, End, FColor::Red, false, 1.0f, 0, 1.0f);
-}
+    if (bAnyResult)
+    {
+        AutofocusHistory[AutofocusHistoryHead] = Nearest;
+        AutofocusHistoryHead = (AutofocusHistoryHead + 1) % AutofocusHistorySize;
+        AutofocusHistoryNum = FMath::Min(AutofocusHistoryNum + 1, AutofocusHistorySize);
+    }
 
-void UCustomCameraComponent::UpdateCamera(float DeltaTime)
-{
-    if (bIsTransitioning)
+    // Queue this frame's rays from the committed view
+    const FVector Start = GetComponentLocation();
+    const FQuat ViewRotation = GetComponentQuat();
+    const FVector Forward = ViewRotation.GetForwardVector();
+    const float RingRadius = FMath::Tan(FMath::DegreesToRadians(Tuning->AutofocusSpread));
+    for (int32 Ray = 0; Ray < NumRays; ++Ray)
     {
-        UpdateTransition(DeltaTime);
+        FVector Direction = Forward;
+        if (Ray > 0)
+        {
+            const float Angle = UE_TWO_PI * (Ray - 1) / (NumRays - 1);
+            Direction = (Forward + (ViewRotation.GetRightVector() * FMath::Cos(Angle) + ViewRotation.GetUpVector() * FMath::Sin(Angle)) * RingRadius).GetSafeNormal();
+        }
+        QueryBatcher.RequestLineTrace(ECameraProbe::Autofocus, Start, Start + Direction * Tuning->AutofocusMaxDistance, ECC_Visibility, static_cast<uint8>(Ray));
     }
 
-    if (bEnableDynamicFOV)
+    if (AutofocusHistoryNum == 0)
     {
-        UpdateDynamicFOV(DeltaTime);
+        return AutofocusDistance >= 0.0f ? AutofocusDistance : Tuning->FocusDistance;
     }
 
-    if (bEnableCollisionPrediction)
+    float Sorted[AutofocusHistorySize];
+    FMemory::Memcpy(Sorted, AutofocusHistory, sizeof(float) * AutofocusHistoryNum);
+    Algo::Sort(MakeArrayView(Sorted, AutofocusHistoryNum));
+    const float Median = Sorted[AutofocusHistoryNum / 2];
+
+    if (AutofocusDistance < 0.0f)
     {
-        PredictAndPreventCollisions();
+        AutofocusDistance = Median;
+        AutofocusVelocity = 0.0f;
     }
+    CameraSpring::CriticallyDamped(AutofocusDistance, AutofocusVelocity, Median, CameraSpring::HalfLifeFromSpeed(Tuning->AutofocusSpeed), Input.DeltaTime);
+    AutofocusDistance = FMath::Max(AutofocusDistance, 1.0f);
+    return AutofocusDistance;
 }
 
-void UCustomCameraComponent::UpdateCameraRotation(float DeltaTime)
+void UCustomCameraComponent::PredictAndPreventCollisions(const FCameraFrameInput& Input, FCameraPoseAccumulator& Pose)
 {
-    // Rotation is handled in the Look function
-}
+    if (!Input.OwnerPawn) return;
 
-void UCustomCameraComponent::UpdateDynamicFOV(float DeltaTime)
-{
-    if (bEnableDynamicFOV)
+    // The boom as it would be once the pawn has moved on for the prediction time
+    const FVector Pivot = Input.OwnerViewLocation;
+    const FVector Boom = Pose.GetWorldLocation(Input) - Pivot;
+    const float DesiredDistance = Boom.Size();
+    if (DesiredDistance <= UE_KINDA_SMALL_NUMBER)
+    {
+        return;
+    }
+    const FVector BoomDirection = Boom / DesiredDistance;
+    const FVector PredictedPivot = Pivot + Input.Velocity * Tuning->CollisionPredictionTime;
+
+    // The sweep is inflated by the recheck distance so a reused result stays conservative, and starts one
+    // inflated radius out along the boom so a pawn standing against a wall doesn't start it inside the wall
+    const float SweepRadius = Tuning->CollisionPredictionRadius + Tuning->CollisionPredictionRecheckDistance;
+    const float StartOffset = FMath::Min(SweepRadius, DesiredDistance);
+    const FVector Start = PredictedPivot + BoomDirection * StartOffset;
+
+    // A cached sweep stands while the predicted path, and so the velocity, stays within the recheck distance
+    FHitResult Hit;
+    bool bHit = false;
+    const bool bCached = PredictionProbeCache.TryGet(Start, BoomDirection, Pivot, Input.WorldTime, Hit, bHit)
+        && FMath::Abs(FVector::Dist(Hit.TraceStart, Hit.TraceEnd) - (DesiredDistance - StartOffset)) <= Tuning->CollisionPredictionRecheckDistance;
+
+    if (!bCached)
     {
-        float DesiredFOV = DefaultFOV;
-        FVector Velocity = FVector::ZeroVector;
-        APawn* OwnerPawn = Cast<APawn>(GetOwner());
-        if (OwnerPawn)
+        // Matched with the path that was requested, which the boom may have moved off since
+        if (const FCameraProbeResult* Result = QueryBatcher.GetResult(ECameraProbe::CollisionPrediction))
         {
-            Velocity = OwnerPawn->GetVelocity();
-        }
+            const FVector SweepDelta = PredictionSweepEnd - PredictionSweepStart;
+            const float SweepLength = SweepDelta.Size();
+            const float SweepOffset = FVector::Dist(PredictionSweepStart, PredictionSweepPivot);
 
-        float Speed = Velocity.Size();
+            // Still starting inside geometry says nothing new about the boom, so the previous distance is kept
+            const bool bBlocked = Result->bBlockingHit && !Result->Hit.bStartPenetrating;
+            if (!Result->Hit.bStartPenetrating)
+            {
+                PredictionTargetDistance = SweepOffset + (bBlocked ? Result->Hit.Time * SweepLength : SweepLength);
 
-        if (bIsAiming)
-        {
-            DesiredFOV = AimingFOV;
-        }
-        else if (bIsRunning && Speed > DynamicZoomThreshold)
-        {
-            DesiredFOV = SprintFOV;
-        }
-        else if (Speed > DynamicZoomThreshold)
-        {
-            DesiredFOV = ZoomedFOV;
+                FHitResult PathHit = Result->Hit;
+                PathHit.TraceStart = PredictionSweepStart;
+                PathHit.TraceEnd = PredictionSweepEnd;
+                PredictionProbeCache.Store(PredictionSweepStart, SweepDelta.GetSafeNormal(), PredictionSweepOrigin, Input.WorldTime, PathHit, bBlocked);
+            }
         }
 
-        AdjustCameraFOV(DeltaTime, DesiredFOV);
+        PredictionSweepStart = Start;
+        PredictionSweepEnd = PredictedPivot + Boom;
+        PredictionSweepPivot = PredictedPivot;
+        PredictionSweepOrigin = Pivot;
+        QueryBatcher.RequestSweep(ECameraProbe::CollisionPrediction, PredictionSweepStart, PredictionSweepEnd, FCollisionShape::MakeSphere(SweepRadius), ECC_Camera);
+        KRYO_DEBUG_LINE(GetWorld(), EKryoDebugCategory::Camera, PredictionSweepStart, PredictionSweepEnd, FColor::Red, 0.5f);
     }
-}
 
-void UCustomCameraComponent::UpdateTransition(float DeltaTime)
-{
-    if (bIsTransitioning)
+    const float TargetDistance = FMath::Clamp(PredictionTargetDistance < 0.0f ? DesiredDistance : PredictionTargetDistance, 0.0f, DesiredDistance);
+    if (PredictionDistance < 0.0f)
     {
-        TransitionElapsedTime += DeltaTime;
-        float Alpha = FMath::Clamp(TransitionElapsedTime / TransitionTotalDuration, 0.0f, 1.0f);
-        FVector NewLocation = FMath::Lerp(TransitionStartPosition, TransitionTargetPosition, Alpha);
-        float NewFOV = FMath::Lerp(TransitionStartFOV, TransitionTargetFOV, Alpha);
-        SetRelativeLocation(NewLocation);
-        SetFieldOfView(NewFOV);
-
-        if (Alpha >= 1.0f)
-        {
-            bIsTransitioning = false;
-        }
+        PredictionDistance = DesiredDistance;
+        PredictionDistanceVelocity = 0.0f;
     }
+
+    // A critically damped spring never overshoots, so the boom can't bounce off a wall it is approaching
+    CameraSpring::CriticallyDamped(PredictionDistance, PredictionDistanceVelocity, TargetDistance, CameraSpring::HalfLifeFromSpeed(Tuning->CollisionPredictionSpeed), Input.DeltaTime);
+    PredictionDistance = FMath::Clamp(PredictionDistance, 0.0f, DesiredDistance);
+
+    Pose.ClampPivotDistance(Pivot, PredictionDistance);
 }
 
-void UCustomCameraComponent::HandleCameraCollision()
+void UCustomCameraComponent::ApplyAdvancedMotionBlur(const FCameraFrameInput& Input)
 {
-    FVector Start = GetComponentLocation();
-    FVector ForwardVector = GetForwardVector();
-    FVector End = Start + ForwardVector * 100.0f;
-    FHitResult HitResult;
-    FCollisionQueryParams Params;
-    Params.AddIgnoredActor(GetOwner());
+    // Use owner pawn velocity to determine intensity
+    float MotionBlurIntensity = FMath::Clamp(Input.Speed / 1000.0f, 0.0f, 1.0f) * Tuning->MotionBlurIntensityMultiplier;
+    PostProcessStack.SetField(ECameraPostProcessLayer::MotionBlur, ECameraPostProcessField::MotionBlurAmount, MotionBlurIntensity);
+}
 
-    bool bHit = GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_Camera, Params);
-    if (bHit)
+void UCustomCameraComponent::ApplyEffectTimeline(const FCameraFrameInput& Input, FCameraPoseAccumulator& Pose)
+{
+    // Every active effect is evaluated once here against world time
+    EffectChannels = EffectTimeline.Evaluate(Input.WorldTime);
+    Pose.AddFieldOfView(EffectChannels.Get(ECameraEffectChannel::FOVOffset));
+
+#if KRYO_DEBUG_DRAW
+    if (EffectChannels.IsActive(ECameraEffectChannel::FOVOffset) && Tuning->WarpMaxFOVIncrease > 0.0f)
     {
-        FVector PushBack = (Start - HitResult.ImpactPoint).GetSafeNormal() * 50.0f;
-        SetRelativeLocation(GetRelativeLocation() + PushBack);
+        float Alpha = EffectChannels.Get(ECameraEffectChannel::FOVOffset) / Tuning->WarpMaxFOVIncrease;
+        KRYO_DEBUG_STRING(GetWorld(), EKryoDebugCategory::Camera, Pose.GetWorldLocation(Input), FString::Printf(TEXT("Warp Effect: %.2f%%"), Alpha * 100.0f), FColor::Yellow);
     }
+#endif
 }
 
-void UCustomCameraComponent::UpdateBasedOnTerrain()
+void UCustomCameraComponent::ApplyEffectPostProcess()
 {
-    if (bEnableTerrainTilt)
+    // The warp layer only contributes while its channels run; afterwards the lower layers show through again
+    const bool bWarpActive = EffectChannels.IsActive(ECameraEffectChannel::Vignette) || EffectChannels.IsActive(ECameraEffectChannel::MotionBlur);
+    PostProcessStack.SetLayerWeight(ECameraPostProcessLayer::Warp, bWarpActive ? 1.0f : 0.0f);
+    if (bWarpActive)
     {
-        FVector Start = GetComponentLocation();
-        FVector End = Start - FVector(0.0f, 0.0f, 100.0f);
-        FHitResult HitResult;
-        FCollisionQueryParams Params;
-        Params.AddIgnoredActor(GetOwner());
-
-        if (GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_Visibility, Params))
-        {
-            FVector TerrainNormal = HitResult.ImpactNormal;
-            FRotator TerrainRotation = TerrainNormal.Rotation();
-            FRotator NewRotation = FRotator(0.0f, TerrainRotation.Yaw, TerrainRotation.Roll);
-            SetRelativeRotation(FMath::RInterpTo(GetRelativeRotation(), NewRotation, GetWorld()->GetDeltaSeconds(), RotationSpeed));
-        }
+        PostProcessStack.SetField(ECameraPostProcessLayer::Warp, ECameraPostProcessField::VignetteIntensity, EffectChannels.Get(ECameraEffectChannel::Vignette));
+        PostProcessStack.SetField(ECameraPostProcessLayer::Warp, ECameraPostProcessField::MotionBlurAmount, EffectChannels.Get(ECameraEffectChannel::MotionBlur));
     }
-}
 
-void UCustomCameraComponent::ClampRotation(FRotator& Rotation)
-{
-    Rotation.Yaw = FMath::Clamp(Rotation.Yaw, -MaxYawRotation, MaxYawRotation);
-    Rotation.Pitch = FMath::Clamp(Rotation.Pitch, -MaxPitchRotation, MaxPitchRotation);
+    if (FadeMaterialInstance && EffectChannels.IsActive(ECameraEffectChannel::FadeAmount))
+    {
+        FadeMaterialInstance->SetScalarParameterValue(FName("FadeAmount"), EffectChannels.Get(ECameraEffectChannel::FadeAmount));
+    }
 }
 
-void UCustomCameraComponent::ApplyTransitionEffects()
+void UCustomCameraComponent::PerformDynamicObstacleDetection()
 {
-    // Implementation for transition effects such as screen fade or blur
-}
+    // Trace from where the camera would be without the previous obstacle offset
+    FVector Start = GetComponentLocation() - ObstacleOffset;
+    FVector ForwardVector = GetForwardVector();
+    FVector End = Start + ForwardVector * 100.0f;
 
-void UCustomCameraComponent::ApplyHeadBobbing(float DeltaTime, bool bIsRunningLocal)
-{
-    float BobMagnitude = bIsRunningLocal ? RunningBobMagnitude : WalkingBobMagnitude;
-    float BobSpeed = BobFrequency * (bIsRunningLocal ? 1.5f : 1.0f);
-    float BobOffset = FMath::Sin(GetWorld()->GetTimeSeconds() * BobSpeed) * BobMagnitude;
-    AddRelativeLocation(FVector(0.0f, 0.0f, BobOffset * DeltaTime));
-}
+    // Submitted with the camera's next batch; the result is applied once it comes back
+    QueryBatcher.RequestLineTrace(ECameraProbe::ObstacleDetection, Start, End, ECC_Camera);
 
-void UCustomCameraComponent::ApplyCameraSway(float DeltaTime)
-{
-    FVector SwayOffset = FVector(
-        FMath::Sin(GetWorld()->GetTimeSeconds() * SwaySpeed) * SwayAmount,
-        FMath::Cos(GetWorld()->GetTimeSeconds() * SwaySpeed) * SwayAmount,
-        0.0f
-    );
-    AddRelativeLocation(SwayOffset * DeltaTime);
+    KRYO_DEBUG_LINE(GetWorld(), EKryoDebugCategory::Camera, Start, End, FColor::Red, 0.0f);
 }
 
-void UCustomCameraComponent::SetupPostProcessMaterial()
+void UCustomCameraComponent::ApplyDynamicObstacleDetection(const FCameraFrameInput& Input, FCameraPoseAccumulator& Pose)
 {
-    if (PostProcessVolume && PostProcessMaterial)
+    if (const FCameraProbeResult* Result = QueryBatcher.GetResult(ECameraProbe::ObstacleDetection))
     {
-        UPostProcessComponent* PPComponent = Cast<UPostProcessComponent>(PostProcessVolume->GetComponentByClass(UPostProcessComponent::StaticClass()));
-        if (PPComponent)
+        if (Result->bBlockingHit)
+        {
+            const FHitResult& HitResult = Result->Hit;
+            KRYO_DEBUG_STRING(GetWorld(), EKryoDebugCategory::Camera, HitResult.ImpactPoint, FString::Printf(TEXT("Obstacle: %s"), HitResult.GetActor() ? *HitResult.GetActor()->GetName() : TEXT("None")), FColor::Red);
+
+            float PushDistance = (HitResult.ImpactPoint - HitResult.TraceStart).Size() - 50.0f;
+            if (PushDistance < 0.0f)
+            {
+                PushDistance = 0.0f;
+            }
+            ObstacleOffset = (HitResult.TraceEnd - HitResult.TraceStart).GetSafeNormal() * PushDistance;
+        }
+        else
         {
-            UMaterialInstanceDynamic* DynMaterial = UMaterialInstanceDynamic::Create(PostProcessMaterial, this);
-            PPComponent->AddOrUpdateBlendable(DynMaterial);
+            ObstacleOffset = FVector::ZeroVector;
         }
     }
-}
 
-bool UCustomCameraComponent::IsInFirstPersonMode() const
-{
-    return bIsFirstPersonMode;
+    Pose.AddWorldOffset(Input, ObstacleOffset);
 }
 
-void UCustomCameraComponent::SetCustomFOV(float NewFOV)
+void UCustomCameraComponent::HandleCameraCollision(const FCameraFrameInput& Input, FCameraPoseAccumulator& Pose)
 {
-    SetFieldOfView(NewFOV);
-}
-
-void UCustomCameraComponent::AdjustCameraFOV(float DeltaTime, float DesiredFOV)
-{
-    float CurrentFOV = FieldOfView;
-    float NewFOV = FMath::FInterpTo(CurrentFOV, DesiredFOV, DeltaTime, 5.0f);
-    SetFieldOfView(NewFOV);
-}
+    FVector Start = Pose.GetWorldLocation(Input);
+    FVector ForwardVector = Pose.GetWorldForward(Input);
+    FVector End = Start + ForwardVector * 100.0f;
 
-void UCustomCameraComponent::HandleDynamicObjectTransparency()
-{
-    FVector Start = GetComponentLocation();
-    FVector End = Start + GetForwardVector() * OcclusionCheckDistance;
+    // Reuse the previous result while neither the probe nor the owner has meaningfully moved
     FHitResult HitResult;
-    FCollisionQueryParams Params;
-    Params.AddIgnoredActor(GetOwner());
-
-    if (GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_Visibility, Params))
+    bool bHit = false;
+    if (CollisionProbeCache.TryGet(Start, ForwardVector, Input.OwnerLocation, Input.WorldTime, HitResult, bHit))
     {
-        UPrimitiveComponent* HitComponent = HitResult.GetComponent();
-        if (HitComponent && !OccludedComponents.Contains(HitComponent))
-        {
-            UMaterialInterface* OriginalMaterial = HitComponent->GetMaterial(0);
-            OccludedComponents.Add(HitComponent, OriginalMaterial);
-
-            UMaterialInstanceDynamic* TransparentMaterialInstance = UMaterialInstanceDynamic::Create(TransparentMaterial, this);
-            TransparentMaterialInstance->SetScalarParameterValue("Transparency", OcclusionTransparencyStrength);
-            HitComponent->SetMaterial(0, TransparentMaterialInstance);
-        }
+        CollisionPushBack = bHit ? (HitResult.TraceStart - HitResult.ImpactPoint).GetSafeNormal() * 50.0f : FVector::ZeroVector;
+    }
+    else if (Tuning->bSynchronousCollisionProbe)
+    {
+        bHit = QueryBatcher.TraceSync(GetWorld(), ECameraProbe::Collision, Start, End, ECC_Camera, HitResult);
+        CollisionProbeCache.Store(Start, ForwardVector, Input.OwnerLocation, Input.WorldTime, HitResult, bHit);
+        CollisionPushBack = bHit ? (Start - HitResult.ImpactPoint).GetSafeNormal() * 50.0f : FVector::ZeroVector;
     }
     else
     {
-        RestoreOccludedObjects();
+        // Async path: keep applying the last known push back until a new result arrives
+        if (const FCameraProbeResult* Result = QueryBatcher.GetResult(ECameraProbe::Collision))
+        {
+            const FHitResult& AsyncHit = Result->Hit;
+            CollisionProbeCache.Store(AsyncHit.TraceStart, (AsyncHit.TraceEnd - AsyncHit.TraceStart).GetSafeNormal(), Input.OwnerLocation, Input.WorldTime, AsyncHit, Result->bBlockingHit);
+            CollisionPushBack = Result->bBlockingHit ? (AsyncHit.TraceStart - AsyncHit.ImpactPoint).GetSafeNormal() * 50.0f : FVector::ZeroVector;
+        }
+        QueryBatcher.RequestLineTrace(ECameraProbe::Collision, Start, End, ECC_Camera);
     }
+
+    Pose.AddWorldOffset(Input, CollisionPushBack);
 }
 
-void UCustomCameraComponent::RestoreOccludedObjects()
+void UCustomCameraComponent::UpdateBasedOnTerrain(const FCameraFrameInput& Input, FCameraPoseAccumulator& Pose)
 {
-    for (auto& Elem : OccludedComponents)
+    FVector Start = Pose.GetWorldLocation(Input);
+    FVector End = Start - FVector(0.0f, 0.0f, 100.0f);
+
+    if (const FCameraProbeResult* Result = QueryBatcher.GetResult(ECameraProbe::Terrain))
     {
-        if (Elem.Key && Elem.Value)
+        TerrainTargetTilt = FRotator::ZeroRotator;
+        if (Result->bBlockingHit)
         {
-            Elem.Key->SetMaterial(0, Elem.Value);
+            // Tilt (pitch/roll only) that aligns the camera up vector with the terrain normal
+            FVector LocalNormal = Input.ParentTransform.InverseTransformVectorNoScale(Result->Hit.ImpactNormal);
+            TerrainTargetTilt = FRotationMatrix::MakeFromZ(LocalNormal).Rotator();
+            TerrainTargetTilt.Yaw = 0.0f;
         }
     }
-    OccludedComponents.Empty();
+    QueryBatcher.RequestLineTrace(ECameraProbe::Terrain, Start, End, ECC_Visibility);
+
+    CameraSpring::CriticallyDamped(TerrainTilt, TerrainTiltVelocity, TerrainTargetTilt, CameraSpring::HalfLifeFromSpeed(Tuning->RotationSpeed), Input.DeltaTime);
+    Pose.AddRotation(TerrainTilt);
+}
+
+void UCustomCameraComponent::ClampRotation(FRotator& Rotation)
+{
+    Rotation.Yaw = FMath::Clamp(Rotation.Yaw, -Tuning->MaxYawRotation, Tuning->MaxYawRotation);
+    Rotation.Pitch = FMath::Clamp(Rotation.Pitch, -Tuning->MaxPitchRotation, Tuning->MaxPitchRotation);
 }
 
-void UCustomCameraComponent::ApplyRecoil(float DeltaTime)
+void UCustomCameraComponent::SetupPostProcessMaterial()
 {
-    if (RecoilRotation != FRotator::ZeroRotator)
+    if (Tuning->PostProcessMaterial)
     {
-        RecoilRotation = FMath::RInterpTo(RecoilRotation, FRotator::ZeroRotator, DeltaTime, RecoilRecoverySpeed);
-        AddLocalRotation(RecoilRotation);
+        if (!PostProcessMaterialInstance)
+        {
+            PostProcessMaterialInstance = MaterialInstancePool.Acquire(Tuning->PostProcessMaterial, this);
+        }
+        PostProcessStack.SetBlendable(ECameraPostProcessLayer::Base, PostProcessMaterialInstance);
     }
 }
 
-void UCustomCameraComponent::UpdateEnvironmentalAwareness()
+bool UCustomCameraComponent::IsInFirstPersonMode() const
 {
-    FVector Start = GetComponentLocation();
-    FVector End = Start + GetForwardVector() * EnvironmentCheckDistance;
-    FHitResult HitResult;
-    FCollisionQueryParams Params;
-    Params.AddIgnoredActor(GetOwner());
+    return bIsFirstPersonMode;
+}
+
+void UCustomCameraComponent::SetCustomFOV(float NewFOV)
+{
+    ++BasePoseSerial;
+    BaseFOV = NewFOV;
+}
 
-    if (GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_Visibility, Params))
+void UCustomCameraComponent::HandleDynamicObjectTransparency(const FCameraFrameInput& Input)
+{
+    // Fold in last frame's samples; the tracker only changes fade targets with hysteresis
+    OccluderTracker.ConsumeResults(QueryBatcher, OcclusionFader);
+
+    if (Input.OwnerPawn)
     {
-        FVector NewLocation = HitResult.Location - GetForwardVector() * 50.0f;
-        SetRelativeLocation(FMath::VInterpTo(GetRelativeLocation(), NewLocation, GetWorld()->GetDeltaSeconds(), 5.0f));
+        // Runs after the commit, so this is the pose being rendered this frame
+        FVector CameraLocation = GetComponentLocation();
+        OccluderTracker.RequestProbes(QueryBatcher, CameraLocation, Input.OwnerViewLocation, Input.OwnerLocation);
     }
+
+    OcclusionFader.Update(Input.DeltaTime);
 }
 
-void UCustomCameraComponent::ApplyCameraInertia(float DeltaTime)
+void UCustomCameraComponent::RestoreOccludedObjects()
 {
-    // Smoothly interpolate the current rotation to the stored target rotation (CurrentRotation)
-    FRotator CurrentRelRotation = GetRelativeRotation();
-    FRotator NewRotation = FMath::RInterpTo(CurrentRelRotation, CurrentRotation, DeltaTime, CameraInertiaStrength);
-    SetRelativeRotation(NewRotation);
+    OccluderTracker.Reset();
+    OcclusionFader.ReleaseAll();
 }
+
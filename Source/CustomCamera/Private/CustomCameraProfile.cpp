@@ -0,0 +1,109 @@
+#include "CustomCameraProfile.h"
+
+#if WITH_EDITOR
+FOnCustomCameraProfileChanged UCustomCameraProfile::OnProfileChanged;
+#endif
+
+UCustomCameraProfile::UCustomCameraProfile()
+{
+    ModeBlendTime = 0.5f;
+    ModeBlendOption = EAlphaBlendOption::HermiteCubic;
+    FirstPersonPosition = FVector(0.0f, 0.0f, 0.0f);
+    ThirdPersonPosition = FVector(-300.0f, 0.0f, 100.0f);
+    AimPositionFirstPerson = FVector(0.0f, 0.0f, 0.0f);
+    AimPositionThirdPerson = FVector(-300.0f, 0.0f, 100.0f);
+    DefaultFOV = 90.0f;
+    AimingFOV = 60.0f;
+    ZoomedFOV = 80.0f;
+    SprintFOV = 70.0f;
+    MaxYawRotation = 90.0f;
+    MaxPitchRotation = 45.0f;
+    RotationSpeed = 2.0f;
+    SwayAmount = 5.0f;
+    SwaySpeed = 2.0f;
+    RunningBobMagnitude = 10.0f;
+    WalkingBobMagnitude = 5.0f;
+    BobFrequency = 10.0f;
+    DepthOfField = 1000.0f;
+    MotionBlurAmount = 1.0f;
+    ColorGradingIntensity = 1.0f;
+    VignetteIntensity = 0.5f;
+    bEnableHeadBobbing = true;
+    bEnableCameraSway = true;
+    bEnableTerrainTilt = false;
+    bEnableCameraLag = true;
+    CameraLagSpeed = 5.0f;
+    bEnableDynamicFOV = true;
+    DynamicZoomThreshold = 500.0f;
+    DynamicZoomSpeed = 2.0f;
+    bEnableContextualPositioning = true;
+    bEnableIntelligentFraming = false;
+    bFrameOwner = true;
+    FramingOwnerRadius = 60.0f;
+    FramingMinDistance = 150.0f;
+    FramingMaxDistance = 1500.0f;
+    FramingMaxFOV = 110.0f;
+    FramingScreenMargin = 0.1f;
+    FramingSpeed = 4.0f;
+    bEnableAdaptiveDepthOfField = false;
+    FocusDistance = 1000.0f;
+    bEnableAutofocus = true;
+    AutofocusRayCount = 3;
+    AutofocusSpread = 2.0f;
+    AutofocusMaxDistance = 10000.0f;
+    AutofocusSpeed = 4.0f;
+    AutofocusUpdateThreshold = 0.02f;
+    bEnableCollisionPrediction = false;
+    CollisionPredictionTime = 0.5f;
+    CollisionPredictionRadius = 12.0f;
+    CollisionPredictionRecheckDistance = 8.0f;
+    CollisionPredictionSpeed = 6.0f;
+    bEnableFocusBasedFOV = false;
+    bEnableAdvancedMotionBlur = false;
+    bEnableCameraInertia = false;
+    CameraInertiaStrength = 5.0f;
+    MinCameraHeight = 50.0f;
+    MaxCameraHeight = 300.0f;
+    bSynchronousCollisionProbe = true;
+    ProbeCacheLocationEpsilon = 1.0f;
+    ProbeCacheAngleEpsilon = 0.5f;
+    ProbeCacheMaxAge = 0.25f;
+    ProbeCacheMissMaxAge = 0.05f;
+    OcclusionTransparencyStrength = 1.0f;
+    OcclusionFadeDataIndex = 0;
+    OcclusionFadeInTime = 0.2f;
+    OcclusionFadeOutTime = 0.35f;
+    OcclusionRaysPerTarget = 3;
+    OcclusionFanRadius = 20.0f;
+    bOcclusionUseSphereSweep = false;
+    OcclusionSweepRadius = 15.0f;
+    OcclusionFadeInSamples = 2;
+    OcclusionFadeOutSamples = 4;
+    MaxTrackedOccluders = 8;
+    WarpMaxFOVIncrease = 30.0f;
+    WarpVignetteIntensity = 1.0f;
+    WarpMotionBlurAmount = 2.0f;
+    WarpDuration = 2.0f;
+    WarpCurve = nullptr;
+    FadeCurve = nullptr;
+    CinematicRailPlayRate = 1.0f;
+    bRecordPoses = true;
+    PoseRecordSeconds = 10.0f;
+    PoseRecordRate = 30.0f;
+    bReplicateToSpectators = false;
+    SpectatorMinSendInterval = 0.1f;
+    SpectatorMaxSendInterval = 1.0f;
+    SpectatorLocationThreshold = 2.0f;
+    SpectatorRotationThreshold = 0.5f;
+    SpectatorFOVThreshold = 0.5f;
+    SpectatorInterpolationDelay = 0.2f;
+    CameraSimulationRate = 0.0f;
+}
+
+#if WITH_EDITOR
+void UCustomCameraProfile::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+    OnProfileChanged.Broadcast(this);
+}
+#endif
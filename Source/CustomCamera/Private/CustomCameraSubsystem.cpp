@@ -0,0 +1,200 @@
+#include "CustomCameraSubsystem.h"
+#include "CustomCameraComponent.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "Async/TaskGraphInterfaces.h"
+
+// Below this many cameras the batch is evaluated inline; the fork/join costs more than it saves
+static constexpr int32 MinCamerasForParallelEvaluate = 4;
+
+void FCustomCameraTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+    if (!Subsystem)
+    {
+        return;
+    }
+
+    if (Phase == ECustomCameraTickPhase::Gather)
+    {
+        Subsystem->GatherCameras(DeltaTime, MyCompletionGraphEvent);
+    }
+    else
+    {
+        Subsystem->ApplyCameras();
+    }
+}
+
+FString FCustomCameraTickFunction::DiagnosticMessage()
+{
+    return Phase == ECustomCameraTickPhase::Gather ? TEXT("FCustomCameraTickFunction[Gather]") : TEXT("FCustomCameraTickFunction[Apply]");
+}
+
+bool UCustomCameraSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // Cameras never update on a dedicated server
+    return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UCustomCameraSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // Gather after pawn movement, in the group the camera components used to tick in
+    GatherTickFunction.Subsystem = this;
+    GatherTickFunction.Phase = ECustomCameraTickPhase::Gather;
+    GatherTickFunction.TickGroup = TG_DuringPhysics;
+    GatherTickFunction.bCanEverTick = true;
+    GatherTickFunction.bStartWithTickEnabled = true;
+    GatherTickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+
+    // Apply before the player camera managers read the camera components
+    ApplyTickFunction.Subsystem = this;
+    ApplyTickFunction.Phase = ECustomCameraTickPhase::Apply;
+    ApplyTickFunction.TickGroup = TG_PostPhysics;
+    ApplyTickFunction.bCanEverTick = true;
+    ApplyTickFunction.bStartWithTickEnabled = true;
+    ApplyTickFunction.AddPrerequisite(this, GatherTickFunction);
+    ApplyTickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UCustomCameraSubsystem::Deinitialize()
+{
+    WaitForEvaluation();
+
+    if (ApplyTickFunction.IsTickFunctionRegistered())
+    {
+        ApplyTickFunction.RemovePrerequisite(this, GatherTickFunction);
+        ApplyTickFunction.UnRegisterTickFunction();
+    }
+    if (GatherTickFunction.IsTickFunctionRegistered())
+    {
+        GatherTickFunction.UnRegisterTickFunction();
+    }
+    GatherTickFunction.Subsystem = nullptr;
+    ApplyTickFunction.Subsystem = nullptr;
+    Cameras.Reset();
+    BatchCameras.Reset();
+    SpectatorCameras.Reset();
+    HintGrid.Reset();
+
+    Super::Deinitialize();
+}
+
+void UCustomCameraSubsystem::RegisterCamera(UCustomCameraComponent* Camera)
+{
+    if (Camera)
+    {
+        Cameras.AddUnique(Camera);
+    }
+}
+
+void UCustomCameraSubsystem::UnregisterCamera(UCustomCameraComponent* Camera)
+{
+    Cameras.RemoveSingleSwap(Camera, false);
+
+    // A camera leaving mid-batch must not receive the results gathered for it
+    for (TWeakObjectPtr<UCustomCameraComponent>& BatchCamera : BatchCameras)
+    {
+        if (BatchCamera.Get() == Camera)
+        {
+            BatchCamera.Reset();
+        }
+    }
+}
+
+void UCustomCameraSubsystem::RegisterSpectatorCamera(UCustomCameraComponent* Camera)
+{
+    if (Camera)
+    {
+        SpectatorCameras.AddUnique(Camera);
+    }
+}
+
+void UCustomCameraSubsystem::UnregisterSpectatorCamera(UCustomCameraComponent* Camera)
+{
+    SpectatorCameras.RemoveSingleSwap(Camera, false);
+}
+
+void UCustomCameraSubsystem::RegisterCameraHint(const ACameraHintVolume* Volume)
+{
+    HintGrid.Add(Volume);
+}
+
+void UCustomCameraSubsystem::UnregisterCameraHint(const ACameraHintVolume* Volume)
+{
+    HintGrid.Remove(Volume);
+}
+
+void UCustomCameraSubsystem::GatherCameras(float DeltaTime, const FGraphEventRef& GatherCompletionEvent)
+{
+    // A batch that never reached apply (e.g. apply tick skipped) must be finished before HotState is reused
+    WaitForEvaluation();
+
+    Cameras.RemoveAllSwap([](const UCustomCameraComponent* Camera) { return !IsValid(Camera); }, false);
+
+    const int32 NumCameras = Cameras.Num();
+    BatchCameras.Reset(NumCameras);
+    if (NumCameras == 0)
+    {
+        return;
+    }
+
+    // Gather: copy each camera's hot state into the arrays
+    HotState.SetNum(NumCameras);
+    for (int32 Index = 0; Index < NumCameras; ++Index)
+    {
+        BatchCameras.Add(Cameras[Index]);
+        Cameras[Index]->GatherCameraUpdate(DeltaTime, HotState, Index);
+    }
+
+    // Evaluate: pure math over the arrays, no UObject access, off the game thread
+    EvaluateEvent = FFunctionGraphTask::CreateAndDispatchWhenReady([this, NumCameras]()
+    {
+        ParallelFor(NumCameras, [this](int32 Index)
+        {
+            HotState.Evaluate(Index);
+        }, NumCameras < MinCamerasForParallelEvaluate ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+    }, TStatId(), nullptr, ENamedThreads::AnyHiPriThreadNormalTask);
+
+    // Ticks depending on gather (the apply tick) wait for the evaluation, the game thread does not
+    if (GatherCompletionEvent.IsValid())
+    {
+        GatherCompletionEvent->DontCompleteUntil(EvaluateEvent);
+    }
+}
+
+void UCustomCameraSubsystem::ApplyCameras()
+{
+    // Normally already complete through the tick prerequisite
+    WaitForEvaluation();
+
+    // Apply: write results back, run scene-dependent modifiers and commit
+    for (int32 Index = 0; Index < BatchCameras.Num(); ++Index)
+    {
+        if (UCustomCameraComponent* Camera = BatchCameras[Index].Get())
+        {
+            Camera->ApplyCameraUpdate(HotState, Index);
+        }
+    }
+    BatchCameras.Reset();
+
+    const double WorldTime = GetWorld()->GetTimeSeconds();
+    for (int32 Index = SpectatorCameras.Num() - 1; Index >= 0; --Index)
+    {
+        UCustomCameraComponent* Camera = SpectatorCameras[Index].Get();
+        if (!Camera || !Camera->UpdateSpectatorView(WorldTime))
+        {
+            SpectatorCameras.RemoveAtSwap(Index, 1, false);
+        }
+    }
+}
+
+void UCustomCameraSubsystem::WaitForEvaluation()
+{
+    if (EvaluateEvent.IsValid())
+    {
+        FTaskGraphInterface::Get().WaitUntilTaskCompletes(EvaluateEvent);
+        EvaluateEvent = nullptr;
+    }
+}
@@ -0,0 +1,76 @@
+#include "Misc/AutomationTest.h"
+#include "CameraFramingSet.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCameraFramingSetSolveTest, "Kryo.Camera.FramingSet.Solve",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FCameraFramingSetSolveTest::RunTest(const FString& Parameters)
+{
+    FCameraFramingSet Set;
+    FCameraFramingSolution Solution;
+    const FQuat ViewRotation = FQuat::Identity;
+
+    FCameraFramingSettings Settings;
+    Settings.ScreenMargin = 0.0f;
+
+    TestFalse(TEXT("Nothing gathered"), Set.Solve(ViewRotation, 90.0f, 1.0f, Settings, Solution));
+
+    // Two points 6 m apart across the view, far from the origin: at 90 degrees and no margin they fit at 300 cm
+    const FVector Offset(200000.0, -300000.0, 500.0);
+    const FSphere Points[] = { FSphere(Offset + FVector(0.0, -300.0, 0.0), 0.0), FSphere(Offset + FVector(0.0, 300.0, 0.0), 0.0) };
+    TestEqual(TEXT("Gathered"), Set.GatherPoints(Points), 2);
+    TestTrue(TEXT("Solved"), Set.Solve(ViewRotation, 90.0f, 1.0f, Settings, Solution));
+    TestTrue(TEXT("Center"), Solution.Center.Equals(Offset, 0.01));
+    TestEqual(TEXT("Radius"), Solution.Radius, 300.0f, 0.01f);
+    TestEqual(TEXT("Half width"), Solution.HalfWidth, 300.0f, 0.01f);
+    TestEqual(TEXT("Half height"), Solution.HalfHeight, 0.0f, 0.01f);
+    TestEqual(TEXT("Distance"), Solution.Distance, 300.0f, 0.1f);
+    TestEqual(TEXT("FOV untouched"), Solution.FieldOfView, 90.0f);
+
+    // The margin narrows the usable half angle to atan(0.9)
+    Settings.ScreenMargin = 0.1f;
+    Set.Solve(ViewRotation, 90.0f, 1.0f, Settings, Solution);
+    TestEqual(TEXT("Distance with margin"), Solution.Distance, 300.0f / 0.9f, 0.1f);
+
+    // Radii push the sides out by r / sin(half angle)
+    const FSphere Spheres[] = { FSphere(Points[0].Center, 50.0), FSphere(Points[1].Center, 50.0) };
+    Set.GatherPoints(Spheres);
+    Settings.ScreenMargin = 0.0f;
+    Set.Solve(ViewRotation, 90.0f, 1.0f, Settings, Solution);
+    TestEqual(TEXT("Distance with radii"), Solution.Distance, 300.0f + 50.0f * UE_SQRT_2, 0.1f);
+    TestEqual(TEXT("Half height with radii"), Solution.HalfHeight, 50.0f, 0.01f);
+
+    // A single sphere on a 16:9 screen is bound by the narrower vertical half angle
+    const FSphere Single(Offset, 200.0);
+    Set.GatherPoints(MakeArrayView(&Single, 1));
+    Set.Solve(ViewRotation, 90.0f, 16.0f / 9.0f, Settings, Solution);
+    TestEqual(TEXT("Single sphere distance"), Solution.Distance, 200.0f / FMath::Sin(FMath::Atan(9.0f / 16.0f)), 0.1f);
+    TestTrue(TEXT("Single sphere center"), Solution.Center.Equals(Offset, 0.01));
+
+    // Small enough to fit closer than MinDistance: the distance clamps up, the FOV stays
+    const FSphere Small(Offset, 20.0);
+    Set.GatherPoints(MakeArrayView(&Small, 1));
+    Set.Solve(ViewRotation, 90.0f, 16.0f / 9.0f, Settings, Solution);
+    TestEqual(TEXT("Clamped to min distance"), Solution.Distance, Settings.MinDistance);
+    TestEqual(TEXT("FOV untouched when clamped up"), Solution.FieldOfView, 90.0f);
+
+    // Capped at 200 cm, the FOV widens until the points fit: 2 * atan(300 / 200)
+    Set.GatherPoints(Points);
+    Settings.MaxDistance = 200.0f;
+    Settings.MinDistance = 100.0f;
+    Settings.MaxFieldOfView = 120.0f;
+    Set.Solve(ViewRotation, 90.0f, 1.0f, Settings, Solution);
+    TestEqual(TEXT("Capped distance"), Solution.Distance, 200.0f, 0.01f);
+    TestEqual(TEXT("Widened FOV"), Solution.FieldOfView, FMath::RadiansToDegrees(2.0f * FMath::Atan(1.5f)), 0.05f);
+
+    // ...but never past MaxFieldOfView
+    Settings.MaxFieldOfView = 100.0f;
+    Set.Solve(ViewRotation, 90.0f, 1.0f, Settings, Solution);
+    TestEqual(TEXT("FOV capped"), Solution.FieldOfView, 100.0f, 0.01f);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
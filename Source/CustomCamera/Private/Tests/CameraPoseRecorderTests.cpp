@@ -0,0 +1,113 @@
+#include "Misc/AutomationTest.h"
+#include "CameraPoseRecorder.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    // Far from the origin, moving fast enough for every frame to carry a real delta
+    FCameraRecordedPose MakeRecordedPose(int64 Serial)
+    {
+        const float Frame = static_cast<float>(Serial);
+
+        FCameraRecordedPose Pose;
+        Pose.Location = FVector(150000.0, -80000.0, 2000.0) + FVector(37.3 * Frame, -12.9 * Frame, 5.0 * FMath::Sin(0.3f * Frame));
+        Pose.Rotation = FRotator(-30.0f + 0.4f * (Serial % 150), FRotator::NormalizeAxis(7.7f * Frame), 0.0f);
+        Pose.FieldOfView = 70.0f + 0.13f * (Serial % 100);
+        for (int32 Layer = 0; Layer < FCameraPostProcessStack::NumLayers; ++Layer)
+        {
+            Pose.LayerWeights[Layer] = ((Serial + Layer * 17) % 50) / 49.0f;
+        }
+        return Pose;
+    }
+
+    void RecordFrames(FCameraPoseRecorder& Recorder, int64 NumFrames)
+    {
+        // First frame is written at once, then one per sample interval
+        for (int64 Serial = 0; Serial < NumFrames; ++Serial)
+        {
+            Recorder.Record(Serial == 0 ? 0.0f : Recorder.GetSampleInterval(), MakeRecordedPose(Serial));
+        }
+    }
+
+    void TestDecodedRange(FAutomationTestBase& Test, const FCameraPoseRecorder& Recorder, int64 First, int64 End)
+    {
+        for (int64 Serial = First; Serial < End; ++Serial)
+        {
+            const FCameraRecordedPose Expected = MakeRecordedPose(Serial);
+            FCameraRecordedPose Decoded;
+            const FString Frame = FString::Printf(TEXT("Serial %lld"), Serial);
+            if (!Test.TestTrue(*(Frame + TEXT(" decodes")), Recorder.Sample(static_cast<double>(Serial), Decoded)))
+            {
+                return;
+            }
+
+            // Quantization: 1/8 cm location, 16-bit axes, 1/64 degree FOV, 8-bit weights
+            Test.TestTrue(*(Frame + TEXT(" location")), Decoded.Location.Equals(Expected.Location, 0.07));
+            Test.TestTrue(*(Frame + TEXT(" rotation")), Decoded.Rotation.Equals(Expected.Rotation, 0.01f));
+            Test.TestEqual(*(Frame + TEXT(" FOV")), Decoded.FieldOfView, Expected.FieldOfView, 1.0f / 64.0f);
+            for (int32 Layer = 0; Layer < FCameraPostProcessStack::NumLayers; ++Layer)
+            {
+                Test.TestEqual(*(Frame + TEXT(" layer weight")), Decoded.LayerWeights[Layer], Expected.LayerWeights[Layer], 1.0f / 255.0f);
+            }
+        }
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCameraPoseRecorderRoundTripTest, "Kryo.Camera.PoseRecorder.RoundTrip",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FCameraPoseRecorderRoundTripTest::RunTest(const FString& Parameters)
+{
+    // 8 Hz keeps the interval exact in float; 10 s is 80 frames, so three blocks plus the spare
+    FCameraPoseRecorder Recorder;
+    Recorder.Initialize(10.0f, 8.0f);
+
+    RecordFrames(Recorder, 100);
+    TestEqual(TEXT("End serial"), Recorder.GetEndSerial(), 100LL);
+    TestEqual(TEXT("First serial before wrapping"), Recorder.GetFirstSerial(), 0LL);
+
+    // Crosses the keys at 32, 64 and 96
+    TestDecodedRange(*this, Recorder, 0, 100);
+
+    // Halfway between two frames either side of a block boundary
+    FCameraRecordedPose Between;
+    Recorder.Sample(31.5, Between);
+    const FVector ExpectedBetween = FMath::Lerp(MakeRecordedPose(31).Location, MakeRecordedPose(32).Location, 0.5);
+    TestTrue(TEXT("Interpolated across a key"), Between.Location.Equals(ExpectedBetween, 0.07));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCameraPoseRecorderWrapTest, "Kryo.Camera.PoseRecorder.Wrap",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FCameraPoseRecorderWrapTest::RunTest(const FString& Parameters)
+{
+    FCameraPoseRecorder Recorder;
+    Recorder.Initialize(10.0f, 8.0f);
+    RecordFrames(Recorder, 300);
+
+    // Four blocks of 32: the newest block (288) and the three before it survive
+    const int64 First = Recorder.GetFirstSerial();
+    TestEqual(TEXT("First serial after wrapping"), First, 192LL);
+    TestEqual(TEXT("First serial starts a block"), First % FCameraPoseRecorder::BlockSize, 0LL);
+
+    TestDecodedRange(*this, Recorder, First, Recorder.GetEndSerial());
+
+    // Serials that have been overwritten clamp to the oldest frame left
+    FCameraRecordedPose Oldest, Clamped;
+    Recorder.Sample(static_cast<double>(First), Oldest);
+    Recorder.Sample(10.0, Clamped);
+    TestTrue(TEXT("Overwritten serial clamps"), Clamped.Location.Equals(Oldest.Location, 0.0));
+
+    // Reset keeps the allocation and starts over from serial 0
+    Recorder.Reset();
+    TestFalse(TEXT("Nothing to sample after Reset"), Recorder.Sample(0.0, Clamped));
+    RecordFrames(Recorder, 40);
+    TestDecodedRange(*this, Recorder, 0, 40);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
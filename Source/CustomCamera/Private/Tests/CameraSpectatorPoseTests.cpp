@@ -0,0 +1,97 @@
+#include "Misc/AutomationTest.h"
+#include "CameraSpectatorPose.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCameraSpectatorPoseDeltaTest, "Kryo.Camera.SpectatorPose.DeltaDecoding",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FCameraSpectatorPoseDeltaTest::RunTest(const FString& Parameters)
+{
+    FCameraSpectatorPoseSender Sender;
+    FCameraSpectatorPoseReceiver Receiver;
+    const FCameraSpectatorSendSettings Settings;
+
+    // Moving past the threshold every step, so each update sends; 600 sends wrap the uint8 sequence twice
+    const int32 NumSteps = 600;
+    int32 NumSent = 0, NumDelta = 0, NumAbsolute = 0, NumLost = 0, NumDecoded = 0;
+    FCameraSpectatorPosePacket LastDelivered;
+    uint8 LastLostSequence = 0;
+    bool bHasDelivered = false;
+
+    for (int32 Step = 0; Step < NumSteps; ++Step)
+    {
+        FCameraSpectatorPose Pose;
+        Pose.Location = FVector(120000.0 + 10.3 * Step, -5000.0 - 4.1 * Step, 300.0 + 50.0 * FMath::Sin(0.05f * Step));
+        Pose.Rotation = FRotator(10.0f * FMath::Sin(0.1f * Step), FRotator::NormalizeAxis(3.3f * Step), 0.0f);
+        Pose.FieldOfView = 85.0f + 0.37f * (Step % 20);
+
+        FCameraSpectatorPosePacket Packet;
+        if (!Sender.Update(0.2f, Pose, Settings, Packet))
+        {
+            continue;
+        }
+        ++NumSent;
+        if (Packet.bHasBase)
+        {
+            ++NumDelta;
+        }
+        else
+        {
+            ++NumAbsolute;
+        }
+
+        // Every seventh packet is lost on the way to the server
+        if (Step % 7 == 3)
+        {
+            ++NumLost;
+            LastLostSequence = Packet.Sequence;
+            continue;
+        }
+
+        FCameraSpectatorPose Decoded;
+        if (!Receiver.Decode(Packet, Decoded))
+        {
+            continue;
+        }
+        ++NumDecoded;
+        bHasDelivered = true;
+        LastDelivered = Packet;
+
+        const FString Sequence = FString::Printf(TEXT("Step %d (sequence %d)"), Step, Packet.Sequence);
+        TestEqual(*(Sequence + TEXT(" location")), Decoded.Location, Pose.Location);
+        TestEqual(*(Sequence + TEXT(" rotation")), Decoded.Rotation, Pose.Rotation);
+        TestEqual(*(Sequence + TEXT(" FOV")), Decoded.FieldOfView, Pose.FieldOfView);
+
+        // Every third ack is lost, and none get through for a stretch longer than the sender's history
+        const bool bAckLost = Step % 3 == 0 || (Step >= 200 && Step < 240);
+        if (!bAckLost)
+        {
+            Sender.Acknowledge(Packet.Sequence);
+        }
+    }
+
+    TestEqual(TEXT("Every update sent"), NumSent, NumSteps);
+    TestTrue(TEXT("Sent delta packets"), NumDelta > 0);
+    TestTrue(TEXT("Fell back to absolute packets once the acks were stale"), NumAbsolute > 1);
+
+    // Only lost packets fail to decode: a lost packet is never the base of a later delta
+    TestEqual(TEXT("Decoded every delivered packet"), NumDecoded, NumSent - NumLost);
+
+    // A duplicate or late packet is rejected
+    FCameraSpectatorPose Duplicate;
+    TestTrue(TEXT("Delivered at least one packet"), bHasDelivered);
+    TestFalse(TEXT("Duplicate packet rejected"), Receiver.Decode(LastDelivered, Duplicate));
+
+    // A delta against a packet the server never received is rejected
+    FCameraSpectatorPosePacket Orphan = LastDelivered;
+    Orphan.Sequence = static_cast<uint8>(LastDelivered.Sequence + 1);
+    Orphan.bHasBase = true;
+    Orphan.BaseSequence = LastLostSequence;
+    FCameraSpectatorPose OrphanPose;
+    TestFalse(TEXT("Unknown base rejected"), Receiver.Decode(Orphan, OrphanPose));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
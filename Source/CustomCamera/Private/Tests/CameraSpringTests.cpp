@@ -0,0 +1,47 @@
+#include "Misc/AutomationTest.h"
+#include "CameraSpring.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCameraSpringStepInvarianceTest, "Kryo.Camera.Spring.StepInvariance",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FCameraSpringStepInvarianceTest::RunTest(const FString& Parameters)
+{
+    // One step of 2*dt must land where two steps of dt do, from rest and mid-flight
+    const float HalfLife = 0.2f;
+    const float DeltaTimes[] = { 1.0f / 240.0f, 1.0f / 60.0f, 1.0f / 30.0f, 0.1f, 0.25f };
+
+    for (const float DeltaTime : DeltaTimes)
+    {
+        float SingleValue = 0.0f, SingleVelocity = 250.0f;
+        float SplitValue = SingleValue, SplitVelocity = SingleVelocity;
+        CameraSpring::CriticallyDamped(SingleValue, SingleVelocity, 100.0f, HalfLife, 2.0f * DeltaTime);
+        CameraSpring::CriticallyDamped(SplitValue, SplitVelocity, 100.0f, HalfLife, DeltaTime);
+        CameraSpring::CriticallyDamped(SplitValue, SplitVelocity, 100.0f, HalfLife, DeltaTime);
+
+        const FString Step = FString::Printf(TEXT("dt %.4f"), DeltaTime);
+        TestEqual(*(Step + TEXT(" float value")), SingleValue, SplitValue, 1.0e-3f);
+        TestEqual(*(Step + TEXT(" float velocity")), SingleVelocity, SplitVelocity, 1.0e-2f);
+
+        FVector SingleLocation(0.0, 0.0, 0.0), SingleLocationVelocity(0.0, -40.0, 10.0);
+        FVector SplitLocation = SingleLocation, SplitLocationVelocity = SingleLocationVelocity;
+        const FVector Goal(300.0, -120.0, 45.0);
+        CameraSpring::CriticallyDamped(SingleLocation, SingleLocationVelocity, Goal, HalfLife, 2.0f * DeltaTime);
+        CameraSpring::CriticallyDamped(SplitLocation, SplitLocationVelocity, Goal, HalfLife, DeltaTime);
+        CameraSpring::CriticallyDamped(SplitLocation, SplitLocationVelocity, Goal, HalfLife, DeltaTime);
+
+        TestTrue(*(Step + TEXT(" vector value")), SingleLocation.Equals(SplitLocation, 1.0e-3));
+        TestTrue(*(Step + TEXT(" vector velocity")), SingleLocationVelocity.Equals(SplitLocationVelocity, 1.0e-2));
+    }
+
+    // A zero half-life snaps to the goal whatever the step
+    float Value = 10.0f, Velocity = 5.0f;
+    CameraSpring::CriticallyDamped(Value, Velocity, 100.0f, 0.0f, 1.0f / 60.0f);
+    TestEqual(TEXT("Snap value"), Value, 100.0f);
+    TestEqual(TEXT("Snap velocity"), Velocity, 0.0f);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,92 @@
+// CameraEffectTimeline.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+
+class UCurveFloat;
+
+// Values a timeline effect can drive
+enum class ECameraEffectChannel : uint8
+{
+    FOVOffset,
+    Vignette,
+    MotionBlur,
+    FadeAmount,
+
+    Count
+};
+
+// Shape an effect follows when it has no curve
+enum class ECameraEffectShape : uint8
+{
+    // 0 to 1 over the duration; for effects that hold at the end
+    Ramp,
+
+    // Up to 1 and back to 0 as sin(pi * t), so the effect has faded out when it is removed
+    Pulse
+};
+
+struct FCameraEffectChannels
+{
+    float Values[static_cast<int32>(ECameraEffectChannel::Count)] = {};
+
+    // Bit per channel that had at least one effect contributing this evaluation
+    uint32 ActiveMask = 0;
+
+    float Get(ECameraEffectChannel Channel) const { return Values[static_cast<int32>(Channel)]; }
+    bool IsActive(ECameraEffectChannel Channel) const { return (ActiveMask & (1u << static_cast<uint32>(Channel))) != 0; }
+};
+
+/**
+ * A single timed effect. The curve is baked into a fixed-size LUT when the effect starts,
+ * so evaluation is a lookup and a lerp.
+ */
+struct FCameraTimelineEffect
+{
+    static constexpr int32 LUTSize = 32;
+
+    int32 Handle = INDEX_NONE;
+    ECameraEffectChannel Channel = ECameraEffectChannel::FOVOffset;
+    float StartTime = 0.0f;
+    float Duration = 0.0f;
+    float Scale = 1.0f;
+
+    // Keep contributing the final value after Duration until stopped
+    bool bHoldAtEnd = false;
+
+    TStaticArray<float, LUTSize> LUT;
+
+    float Sample(float NormalizedTime) const;
+};
+
+/**
+ * Per-camera effect timeline. Effects are plain structs evaluated against world time once per
+ * camera update in a single loop, replacing the per-effect looping timers.
+ */
+class CUSTOMCAMERA_API FCameraEffectTimeline
+{
+public:
+    /**
+     * Starts an effect on Channel. Curve is sampled over its own time range and scaled by Scale;
+     * without a curve the effect follows DefaultShape.
+     */
+    int32 Play(ECameraEffectChannel Channel, float StartTime, float Duration, float Scale, const UCurveFloat* Curve = nullptr, bool bHoldAtEnd = false,
+        ECameraEffectShape DefaultShape = ECameraEffectShape::Ramp);
+
+    void Stop(int32 Handle);
+    void StopChannel(ECameraEffectChannel Channel);
+    void Reset();
+
+    /** Sums every active effect per channel at WorldTime and drops the ones that finished */
+    FCameraEffectChannels Evaluate(float WorldTime);
+
+    bool IsEmpty() const { return Effects.Num() == 0; }
+
+private:
+    static void BakeCurve(FCameraTimelineEffect& Effect, const UCurveFloat* Curve, ECameraEffectShape DefaultShape);
+
+    TArray<FCameraTimelineEffect, TInlineAllocator<8>> Effects;
+    int32 NextHandle = 0;
+};
@@ -0,0 +1,92 @@
+// CameraFramingSet.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+
+struct FCameraFramingSettings
+{
+    // Camera distance from the group's centre is kept within this range (cm)
+    float MinDistance = 150.0f;
+    float MaxDistance = 1500.0f;
+
+    // Horizontal FOV is only widened, up to this, once the distance is capped (degrees)
+    float MaxFieldOfView = 110.0f;
+
+    // Fraction of each half of the screen kept clear around the targets
+    float ScreenMargin = 0.1f;
+};
+
+struct FCameraFramingSolution
+{
+    // World-space bounding sphere of every framed target
+    FVector Center = FVector::ZeroVector;
+    float Radius = 0.0f;
+
+    // Largest view-space offsets of the targets from the centre, their radii included
+    float HalfWidth = 0.0f;
+    float HalfHeight = 0.0f;
+
+    // Distance back from Center along the view direction, and the horizontal FOV to use there
+    float Distance = 0.0f;
+    float FieldOfView = 90.0f;
+};
+
+/**
+ * Subjects the camera keeps in frame together: squad members, a boss, a locked target. Target
+ * positions are gathered into plain float lanes relative to the first target, and the bounding
+ * sphere, screen extents and required distance are each one SIMD pass over the lanes, so a full
+ * set of 32 costs a few hundred instructions.
+ */
+class CUSTOMCAMERA_API FCameraFramingSet
+{
+public:
+    // Multiple of 4, the passes handle four targets per step
+    static constexpr int32 Capacity = 32;
+
+    /** Adds Actor, or updates its radius if already present; returns false when the set is full */
+    bool Add(const AActor* Actor, float Radius);
+    bool Remove(const AActor* Actor);
+    void Reset();
+
+    int32 Num() const { return Targets.Num(); }
+
+    /**
+     * Reads the target locations for this frame and drops destroyed actors. The extra point
+     * (usually the camera's own pawn) is framed alongside the set when bIncludeExtra.
+     * Returns the number of gathered points.
+     */
+    int32 Gather(bool bIncludeExtra, const FVector& ExtraLocation, float ExtraRadius);
+
+    /** Gathers explicit spheres (W is the radius) instead of the targets, up to Capacity; returns the number gathered */
+    int32 GatherPoints(TArrayView<const FSphere> Points);
+
+    /**
+     * Solves the gathered points for a camera looking along ViewRotation with a horizontal
+     * FieldOfView. Returns false when nothing was gathered.
+     */
+    bool Solve(const FQuat& ViewRotation, float FieldOfView, float AspectRatio, const FCameraFramingSettings& Settings, FCameraFramingSolution& OutSolution) const;
+
+private:
+    struct FTarget
+    {
+        TWeakObjectPtr<const AActor> Actor;
+        float Radius = 0.0f;
+    };
+
+    void SetLane(int32 Lane, const FVector& Location, float Radius);
+    void PadLanes();
+
+    TArray<FTarget, TInlineAllocator<Capacity>> Targets;
+
+    // Gathered points relative to Origin; lanes past NumPoints up to the next multiple of 4 repeat lane 0
+    alignas(16) float PointX[Capacity];
+    alignas(16) float PointY[Capacity];
+    alignas(16) float PointZ[Capacity];
+    alignas(16) float PointRadius[Capacity];
+
+    FVector Origin = FVector::ZeroVector;
+    int32 NumPoints = 0;
+};
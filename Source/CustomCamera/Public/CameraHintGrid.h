@@ -0,0 +1,57 @@
+// CameraHintGrid.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class ACameraHintVolume;
+
+/**
+ * Uniform-grid spatial hash of camera hint volumes. Each volume is listed in every cell its
+ * bounds overlap, so finding the hint at a point hashes one cell and tests the few oriented boxes
+ * listed there. Volumes spanning more than MaxCellsPerVolume cells go to a short overflow list
+ * tested on every lookup instead. Volumes are static once added; a moved volume is removed and added again.
+ */
+class CUSTOMCAMERA_API FCameraHintGrid
+{
+public:
+    // Larger volumes are kept in the overflow list rather than stamped into every cell
+    static constexpr int32 MaxCellsPerVolume = 4096;
+
+    explicit FCameraHintGrid(float InCellSize = 1000.0f);
+
+    /** Adds or re-adds Volume at its current transform */
+    void Add(const ACameraHintVolume* Volume);
+    void Remove(const ACameraHintVolume* Volume);
+    void Reset();
+
+    /** Highest-priority volume containing Location, or null */
+    const ACameraHintVolume* Find(const FVector& Location) const;
+
+    int32 Num() const { return Entries.Num(); }
+
+private:
+    struct FEntry
+    {
+        TWeakObjectPtr<const ACameraHintVolume> Volume;
+        FTransform Transform;
+        FVector Extent = FVector::ZeroVector;
+        int32 Priority = 0;
+        FIntVector MinCell = FIntVector::ZeroValue;
+        FIntVector MaxCell = FIntVector::ZeroValue;
+        bool bOversized = false;
+    };
+
+    FIntVector ToCell(const FVector& Location) const;
+
+    /** Makes Entry the best so far if it contains Location and outranks Best */
+    static void Consider(const FEntry& Entry, const FVector& Location, const ACameraHintVolume*& Best, int32& BestPriority);
+
+    float CellSize;
+    float InvCellSize;
+
+    TSparseArray<FEntry> Entries;
+    TMap<const ACameraHintVolume*, int32> EntryByVolume;
+    TMap<FIntVector, TArray<int32, TInlineAllocator<2>>> Cells;
+    TArray<int32> OversizedEntries;
+};
@@ -0,0 +1,74 @@
+// CameraHintVolume.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "CameraHintVolume.generated.h"
+
+class UBoxComponent;
+
+/** What a hint changes about the camera while its owner stands inside the volume */
+USTRUCT(BlueprintType)
+struct CUSTOMCAMERA_API FCameraHintSettings
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Hint")
+    bool bOverrideOffset = false;
+
+    // Added to the camera in view space (X forward, Y right, Z up), e.g. pulled in for corridors
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Hint", meta = (EditCondition = "bOverrideOffset"))
+    FVector Offset = FVector::ZeroVector;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Hint")
+    bool bOverrideFieldOfView = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Hint", meta = (EditCondition = "bOverrideFieldOfView", ClampMin = "5.0", ClampMax = "170.0"))
+    float FieldOfView = 90.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Hint")
+    bool bOverrideLagSpeed = false;
+
+    // How quickly the camera catches up with its pose; lower trails further behind
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Hint", meta = (EditCondition = "bOverrideLagSpeed", ClampMin = "0.0"))
+    float LagSpeed = 5.0f;
+
+    // How quickly the camera blends into this hint, and back out of it
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Hint", meta = (ClampMin = "0.0"))
+    float BlendSpeed = 3.0f;
+};
+
+/**
+ * Level-authored camera hint for tight corridors, open vistas, interiors and the like. Volumes
+ * register with the camera subsystem's spatial hash at BeginPlay; cameras look up the hint at
+ * their owner's location each frame instead of probing the scene.
+ */
+UCLASS()
+class CUSTOMCAMERA_API ACameraHintVolume : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    ACameraHintVolume();
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+    /** Re-registers the volume after it was moved or resized at runtime */
+    UFUNCTION(BlueprintCallable, Category = "Camera|Hint")
+    void UpdateRegistration();
+
+    // Oriented box the hint applies in
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera|Hint")
+    UBoxComponent* Bounds;
+
+    // Where volumes overlap, the highest priority wins
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Hint")
+    int32 Priority;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Hint")
+    FCameraHintSettings Settings;
+};
@@ -0,0 +1,185 @@
+// CameraHotState.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Bit per enabled camera feature, built when the profile is applied. The pose features up to Recoil
+// are evaluated in the batched pass, the rest by the component on the game thread after it
+enum class ECameraHotFeature : uint32
+{
+    None            = 0,
+    DynamicFOV      = 1 << 0,
+    DynamicZoom     = 1 << 1,
+    FocusFOV        = 1 << 2,
+    ShoulderOffset  = 1 << 3,
+    HeadBob         = 1 << 4,
+    Sway            = 1 << 5,
+    Inertia         = 1 << 6,
+    Recoil          = 1 << 7,
+
+    ContextualPositioning   = 1 << 8,
+    CollisionPrediction     = 1 << 9,
+    ObstacleDetection       = 1 << 10,
+    IntelligentFraming      = 1 << 11,
+    TerrainTilt             = 1 << 12,
+    AdaptiveDepthOfField    = 1 << 13,
+    MotionBlur              = 1 << 14,
+    ObjectTransparency      = 1 << 15,
+};
+ENUM_CLASS_FLAGS(ECameraHotFeature);
+
+// Feature masks with their own compiled update variants; any other mask takes the generic path
+namespace CameraFeatureMasks
+{
+    // UCustomCameraProfile's class defaults
+    constexpr ECameraHotFeature Default = ECameraHotFeature::DynamicFOV | ECameraHotFeature::HeadBob | ECameraHotFeature::Sway
+        | ECameraHotFeature::ContextualPositioning;
+
+    constexpr ECameraHotFeature ShooterThirdPerson = ECameraHotFeature::DynamicFOV | ECameraHotFeature::ShoulderOffset | ECameraHotFeature::Recoil
+        | ECameraHotFeature::ContextualPositioning | ECameraHotFeature::CollisionPrediction | ECameraHotFeature::ObjectTransparency;
+
+    constexpr ECameraHotFeature ShooterFirstPerson = ECameraHotFeature::DynamicFOV | ECameraHotFeature::HeadBob | ECameraHotFeature::Sway
+        | ECameraHotFeature::Inertia | ECameraHotFeature::Recoil;
+}
+
+// Feature set of a compiled variant: every test folds to a constant and disabled features compile out
+template<ECameraHotFeature Mask>
+struct TCameraFeatures
+{
+    static constexpr bool Has(ECameraHotFeature Feature) { return EnumHasAnyFlags(Mask, Feature); }
+};
+
+// Feature set of the generic variant, tested at run time
+struct FCameraDynamicFeatures
+{
+    ECameraHotFeature Mask = ECameraHotFeature::None;
+
+    bool Has(ECameraHotFeature Feature) const { return EnumHasAnyFlags(Mask, Feature); }
+};
+
+/** Calls Func with the compiled feature set for Mask, or with the generic one when Mask has no variant */
+template<typename FuncType>
+FORCEINLINE void DispatchCameraFeatures(ECameraHotFeature Mask, FuncType&& Func)
+{
+    // Switched on the raw bits: the combined masks are not enumerators
+    switch (static_cast<uint32>(Mask))
+    {
+    case static_cast<uint32>(CameraFeatureMasks::Default):
+        Func(TCameraFeatures<CameraFeatureMasks::Default>());
+        break;
+    case static_cast<uint32>(CameraFeatureMasks::ShooterThirdPerson):
+        Func(TCameraFeatures<CameraFeatureMasks::ShooterThirdPerson>());
+        break;
+    case static_cast<uint32>(CameraFeatureMasks::ShooterFirstPerson):
+        Func(TCameraFeatures<CameraFeatureMasks::ShooterFirstPerson>());
+        break;
+    default:
+        Func(FCameraDynamicFeatures{ Mask });
+        break;
+    }
+}
+
+// Per-camera tuning the batched pass reads; copied from the component during gather
+struct FCameraHotSettings
+{
+    // FOV arbitration
+    float DefaultFOV = 90.0f;
+    float AimingFOV = 60.0f;
+    float SprintFOV = 70.0f;
+    float ZoomedFOV = 80.0f;
+    float DynamicZoomThreshold = 500.0f;
+    float DynamicZoomSpeed = 2.0f;
+    float FocusDistance = 1000.0f;
+
+    // Oscillation
+    float WalkingBobMagnitude = 5.0f;
+    float RunningBobMagnitude = 10.0f;
+    float BobFrequency = 10.0f;
+    float SwayAmount = 5.0f;
+    float SwaySpeed = 2.0f;
+
+    // Offsets and rotation
+    FVector OverShoulderOffset = FVector::ZeroVector;
+    float RepositioningSpeed = 0.0f;
+    float InertiaStrength = 5.0f;
+    float RecoilRecoverySpeed = 0.0f;
+
+    // Simulation step in seconds; 0 steps once per frame with the frame's delta time
+    float FixedStep = 0.0f;
+};
+
+// Spring velocities carried alongside the smoothed state
+struct FCameraHotSprings
+{
+    float FieldOfView = 0.0f;
+    FVector ShoulderOffset = FVector::ZeroVector;
+    FRotator InertiaRotation = FRotator::ZeroRotator;
+    FRotator RecoilRotation = FRotator::ZeroRotator;
+};
+
+// What one simulation step produces; with a fixed step the pose interpolates between the last two
+struct FCameraHotStepOutput
+{
+    float FieldOfView = 90.0f;
+    FVector ShoulderOffset = FVector::ZeroVector;
+    FVector OscillationOffset = FVector::ZeroVector;
+    FRotator Rotation = FRotator::ZeroRotator;
+    FRotator RecoilRotation = FRotator::ZeroRotator;
+
+    static FCameraHotStepOutput Lerp(const FCameraHotStepOutput& A, const FCameraHotStepOutput& B, float Alpha);
+};
+
+/**
+ * Structure-of-arrays working set for every camera updated in a batch. The owning subsystem
+ * copies each camera's hot state in on the game thread, Evaluate runs once per index with no
+ * UObject access (safe to run in parallel), and the results are written back on the game thread.
+ */
+struct CUSTOMCAMERA_API FCameraHotStateArrays
+{
+    // Read-only during evaluation
+    TArray<FCameraHotSettings> Settings;
+    TArray<ECameraHotFeature> Features;
+    TArray<float> DeltaTime;
+    TArray<float> Speed;
+    TArray<bool> bIsAiming;
+    TArray<bool> bIsRunning;
+    TArray<FRotator> LookRotation;
+
+    // State carried between frames, updated in place
+    TArray<float> FieldOfView;
+    TArray<float> BobPhase;
+    TArray<float> SwayPhase;
+    TArray<FVector> ShoulderOffset;
+    TArray<FRotator> InertiaRotation;
+    TArray<FRotator> RecoilRotation;
+    TArray<FCameraHotSprings> Springs;
+    TArray<float> StepAccumulator;
+    TArray<FCameraHotStepOutput> PreviousStep;
+
+    // Outputs of the latest step
+    TArray<FVector> OscillationOffset;
+    TArray<FRotator> DesiredRotation;
+
+    // What the pose uses this frame: the latest step, or the blend between the last two with a fixed step
+    TArray<FCameraHotStepOutput> Output;
+
+    /** Resizes every column; allocations are kept when the count shrinks */
+    void SetNum(int32 NewNum);
+    int32 Num() const { return Features.Num(); }
+
+    /** Steps FOV arbitration, shoulder offset, bob, sway, inertia and recoil decay for one camera and fills Output */
+    void Evaluate(int32 Index);
+
+private:
+    // A hitch longer than this many fixed steps drops the remaining time instead of spiralling
+    static constexpr int32 MaxStepsPerFrame = 8;
+
+    template<typename TFeatures>
+    void Evaluate(int32 Index, TFeatures Enabled);
+
+    template<typename TFeatures>
+    void Step(int32 Index, float Dt, TFeatures Enabled);
+
+    FCameraHotStepOutput CaptureStep(int32 Index) const;
+};
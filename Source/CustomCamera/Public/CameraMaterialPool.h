@@ -0,0 +1,44 @@
+// CameraMaterialPool.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CameraMaterialPool.generated.h"
+
+class UMaterialInterface;
+class UMaterialInstanceDynamic;
+
+USTRUCT()
+struct FPooledMaterialInstance
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    UMaterialInstanceDynamic* Instance = nullptr;
+
+    bool bInUse = false;
+};
+
+/**
+ * Small pool of dynamic material instances keyed by parent material.
+ * Released instances keep their UObject alive and get their parameters reset on reuse,
+ * so toggling an effect doesn't allocate or create GC garbage.
+ */
+USTRUCT()
+struct CUSTOMCAMERA_API FCameraMaterialInstancePool
+{
+    GENERATED_BODY()
+
+    /** Returns a free instance of Parent with default parameters, creating one only if none is free */
+    UMaterialInstanceDynamic* Acquire(UMaterialInterface* Parent, UObject* Outer);
+
+    /** Returns Instance to the pool; it stays valid but must no longer be used by the caller */
+    void Release(UMaterialInstanceDynamic* Instance);
+
+    /** Forgets every pooled instance and lets GC collect them */
+    void Empty();
+
+private:
+    UPROPERTY()
+    TArray<FPooledMaterialInstance> Entries;
+};
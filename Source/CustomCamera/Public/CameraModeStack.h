@@ -0,0 +1,94 @@
+// CameraModeStack.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AlphaBlend.h"
+#include "CameraPose.h"
+#include "CameraModeStack.generated.h"
+
+UENUM(BlueprintType)
+enum class ECameraMode : uint8
+{
+    ThirdPerson UMETA(DisplayName = "Third Person"),
+    FirstPerson UMETA(DisplayName = "First Person"),
+    FreeCamera UMETA(DisplayName = "Free Camera"),
+    Cinematic UMETA(DisplayName = "Cinematic")
+};
+
+/**
+ * Everything a mode evaluator may read, built once per frame by the owning component.
+ * Locations and rotations are relative to the attach parent, like FCameraPoseAccumulator.
+ */
+struct FCameraModeContext
+{
+    const FCameraFrameInput& Frame;
+
+    FRotator LookRotation = FRotator::ZeroRotator;
+    float DefaultFOV = 90.0f;
+
+    FVector ThirdPersonLocation = FVector::ZeroVector;
+    FVector FirstPersonLocation = FVector::ZeroVector;
+    FVector FreeCameraLocation = FVector::ZeroVector;
+
+    FVector CinematicLocation = FVector::ZeroVector;
+    FRotator CinematicRotation = FRotator::ZeroRotator;
+    float CinematicFOV = 90.0f;
+
+    explicit FCameraModeContext(const FCameraFrameInput& InFrame)
+        : Frame(InFrame) {
+    }
+};
+
+namespace CameraModes
+{
+    /** Stateless: the same context always produces the same pose for a mode */
+    CUSTOMCAMERA_API FCameraPoseAccumulator Evaluate(ECameraMode Mode, const FCameraModeContext& Context);
+}
+
+struct FCameraModeStackEntry
+{
+    ECameraMode Mode = ECameraMode::ThirdPerson;
+    EAlphaBlendOption BlendOption = EAlphaBlendOption::HermiteCubic;
+    float BlendTime = 0.0f;
+    float Elapsed = 0.0f;
+
+    // Eased 0..1 weight this entry blends over the entries below it with
+    float Weight = 1.0f;
+
+    // Set by scripted transitions: replaces the mode's own location and FOV
+    bool bOverrideAnchor = false;
+    FVector AnchorLocation = FVector::ZeroVector;
+    float AnchorFOV = 90.0f;
+};
+
+/**
+ * Weighted stack of active camera modes, bottom to top. A push blends the new mode in over
+ * whatever the stack currently shows, so interrupting a blend continues from the current pose.
+ * Entries hidden under a fully weighted entry are dropped, and only entries with a non-zero
+ * weight are evaluated.
+ */
+class CUSTOMCAMERA_API FCameraModeStack
+{
+public:
+    static constexpr int32 MaxEntries = 8;
+
+    /** Blends Mode in over BlendTime seconds; a non-positive BlendTime cuts to it */
+    void Push(ECameraMode Mode, float BlendTime, EAlphaBlendOption BlendOption);
+
+    /** As Push, but the mode is placed at Location with FOV instead of its own anchor */
+    void PushAnchored(ECameraMode Mode, const FVector& Location, float FOV, float BlendTime, EAlphaBlendOption BlendOption);
+
+    /** Advances the blend weights by DeltaTime and returns the blended pose */
+    FCameraPoseAccumulator Evaluate(const FCameraModeContext& Context, float DeltaTime);
+
+    bool IsBlending() const { return Entries.Num() > 1; }
+    bool IsEmpty() const { return Entries.Num() == 0; }
+
+    void Reset();
+
+private:
+    void PushEntry(const FCameraModeStackEntry& Entry);
+
+    TArray<FCameraModeStackEntry, TInlineAllocator<MaxEntries>> Entries;
+};
@@ -0,0 +1,72 @@
+// CameraOccluderTracker.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UPrimitiveComponent;
+class FCameraQueryBatcher;
+class FCameraOcclusionFader;
+
+struct FCameraOccluderTrackerSettings
+{
+    // Rays cast toward each target point; 1 casts only the centre ray
+    int32 RaysPerTarget = 3;
+
+    // Radius of the ray fan around the camera-to-target axis (cm)
+    float FanRadius = 20.0f;
+
+    // Cast one sphere sweep per target instead of a ray fan
+    bool bUseSphereSweep = false;
+    float SweepRadius = 15.0f;
+
+    // Probes stop this far short of the target so the pawn's own attachments aren't picked up
+    float EndPadding = 30.0f;
+
+    // Samples out of the last HistoryLength that must hit before an occluder fades in
+    int32 FadeInSamples = 2;
+
+    // Consecutive missed samples before an occluder fades back out
+    int32 FadeOutSamples = 4;
+
+    int32 MaxTrackedOccluders = 8;
+};
+
+/**
+ * Finds geometry between the camera and its pawn. Every sample casts a small fan of rays
+ * (or one sphere sweep) toward the pawn's head and chest through the camera query batcher,
+ * keeps a short hit history per occluder and only starts or stops fades with hysteresis.
+ */
+class CUSTOMCAMERA_API FCameraOccluderTracker
+{
+public:
+    static constexpr int32 HistoryLength = 8;
+
+    void Configure(const FCameraOccluderTrackerSettings& InSettings);
+
+    /** Queues this frame's probes from CameraLocation toward the head and chest */
+    void RequestProbes(FCameraQueryBatcher& Batcher, const FVector& CameraLocation, const FVector& HeadLocation, const FVector& ChestLocation) const;
+
+    /** Folds the probe results that arrived this frame into the hit history and updates the fader's targets */
+    void ConsumeResults(const FCameraQueryBatcher& Batcher, FCameraOcclusionFader& Fader);
+
+    void Reset();
+
+    int32 Num() const { return Occluders.Num(); }
+
+private:
+    struct FTrackedOccluder
+    {
+        TWeakObjectPtr<UPrimitiveComponent> Component;
+        uint8 History = 0;
+        bool bFading = false;
+    };
+
+    int32 GetNumProbes() const;
+    void RequestTargetProbes(FCameraQueryBatcher& Batcher, const FVector& CameraLocation, const FVector& TargetLocation, int32 FirstIndex) const;
+
+    FCameraOccluderTrackerSettings Settings;
+    uint8 FadeOutMask = 0x0F;
+
+    TArray<FTrackedOccluder, TInlineAllocator<8>> Occluders;
+};
@@ -0,0 +1,49 @@
+// CameraOcclusionFader.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UPrimitiveComponent;
+
+struct FOccluderFadeState
+{
+    TWeakObjectPtr<UPrimitiveComponent> Component;
+    float Fade = 0.0f;
+    float TargetFade = 0.0f;
+};
+
+/**
+ * Fades occluding primitives by writing a scalar into their Custom Primitive Data.
+ * The occluder keeps its own material (and its cached mesh draw commands); the material is
+ * expected to read the fade amount from CPD slot DataIndex, where 1 means fully faded.
+ */
+class CUSTOMCAMERA_API FCameraOcclusionFader
+{
+public:
+    void Configure(int32 InDataIndex, float InFadeInTime, float InFadeOutTime, float InMaxFade);
+
+    /** Fades every tracked occluder back out unless it is marked again */
+    void ClearTargets();
+
+    /** Starts (or keeps) fading Component in */
+    void MarkOccluded(UPrimitiveComponent* Component);
+
+    /** Advances all fades and writes the ones that changed; fully restored occluders are dropped */
+    void Update(float DeltaTime);
+
+    /** Restores every occluder immediately */
+    void ReleaseAll();
+
+    int32 Num() const { return Occluders.Num(); }
+
+private:
+    void WriteFade(UPrimitiveComponent* Component, float Fade) const;
+
+    int32 DataIndex = 0;
+    float FadeInRate = 5.0f;
+    float FadeOutRate = 3.0f;
+    float MaxFade = 1.0f;
+
+    TArray<FOccluderFadeState, TInlineAllocator<8>> Occluders;
+};
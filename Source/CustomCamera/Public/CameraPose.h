@@ -0,0 +1,118 @@
+// CameraPose.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class APawn;
+class UPawnMovementComponent;
+
+/**
+ * Immutable per-frame context shared by every camera pose modifier.
+ * Gathered once at the start of the camera update; modifiers read owner and movement
+ * state from here instead of querying the actor again, and must not change it.
+ */
+struct FCameraFrameInput
+{
+    float DeltaTime = 0.0f;
+    float WorldTime = 0.0f;
+
+    // Null when the camera is not owned by a pawn
+    const APawn* OwnerPawn = nullptr;
+    const UPawnMovementComponent* MovementComponent = nullptr;
+
+    // Attach parent to world (the space relative location/rotation are expressed in)
+    FTransform ParentTransform = FTransform::Identity;
+
+    // Camera transform as committed last frame
+    FTransform ComponentTransform = FTransform::Identity;
+
+    FVector OwnerLocation = FVector::ZeroVector;
+    FVector OwnerViewLocation = FVector::ZeroVector;
+    FVector Velocity = FVector::ZeroVector;
+    float Speed = 0.0f;
+    FRotator ControlRotation = FRotator::ZeroRotator;
+
+    bool bIsAiming = false;
+    bool bIsRunning = false;
+};
+
+/**
+ * Pose accumulator filled by the camera modifiers in their declared order.
+ * Location and rotation are relative to the attach parent; the owning component
+ * commits the result once per frame.
+ */
+struct FCameraPoseAccumulator
+{
+    FVector Location = FVector::ZeroVector;
+    FRotator Rotation = FRotator::ZeroRotator;
+    float FieldOfView = 90.0f;
+
+    // Optional cap on the distance from Pivot (world space, as the sweeps that produce it), enforced once when the pose is committed
+    FVector Pivot = FVector::ZeroVector;
+    float MaxPivotDistance = 0.0f;
+    bool bClampPivotDistance = false;
+
+    FCameraPoseAccumulator() = default;
+
+    FCameraPoseAccumulator(const FVector& InLocation, const FRotator& InRotation, float InFieldOfView)
+        : Location(InLocation), Rotation(InRotation), FieldOfView(InFieldOfView) {
+    }
+
+    FVector GetWorldLocation(const FCameraFrameInput& Input) const
+    {
+        return Input.ParentTransform.TransformPosition(Location);
+    }
+
+    FVector GetWorldForward(const FCameraFrameInput& Input) const
+    {
+        return Input.ParentTransform.TransformVectorNoScale(Rotation.Vector());
+    }
+
+    void AddLocalOffset(const FVector& Offset)
+    {
+        Location += Offset;
+    }
+
+    // Location is scaled by the parent, so the offset is unscaled to land at its world length
+    void AddWorldOffset(const FCameraFrameInput& Input, const FVector& WorldOffset)
+    {
+        Location += Input.ParentTransform.InverseTransformVector(WorldOffset);
+    }
+
+    void AddRotation(const FRotator& DeltaRotation)
+    {
+        Rotation += DeltaRotation;
+    }
+
+    void AddFieldOfView(float DeltaFOV)
+    {
+        FieldOfView += DeltaFOV;
+    }
+
+    /** Caps the final distance from InPivot (world space, cm); the tightest of several caps wins */
+    void ClampPivotDistance(const FVector& InPivot, float MaxDistance)
+    {
+        if (!bClampPivotDistance || MaxDistance < MaxPivotDistance)
+        {
+            Pivot = InPivot;
+            MaxPivotDistance = FMath::Max(MaxDistance, 0.0f);
+            bClampPivotDistance = true;
+        }
+    }
+
+    /** Pulls the location towards the pivot along its current direction if it is past the cap */
+    void ResolvePivotDistance(const FCameraFrameInput& Input)
+    {
+        if (bClampPivotDistance)
+        {
+            // Measured in world space, where the parent's scale doesn't stretch the cap
+            const FVector FromPivot = GetWorldLocation(Input) - Pivot;
+            if (FromPivot.SizeSquared() > FMath::Square(MaxPivotDistance))
+            {
+                Location = Input.ParentTransform.InverseTransformPosition(Pivot + FromPivot.GetSafeNormal() * MaxPivotDistance);
+            }
+            bClampPivotDistance = false;
+        }
+    }
+};
@@ -0,0 +1,79 @@
+// CameraPoseRecorder.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CameraPostProcessStack.h"
+
+// A committed camera pose in world space, as recorded and played back
+struct FCameraRecordedPose
+{
+    FVector Location = FVector::ZeroVector;
+    FRotator Rotation = FRotator::ZeroRotator;
+    float FieldOfView = 90.0f;
+    float LayerWeights[FCameraPostProcessStack::NumLayers] = {};
+};
+
+/**
+ * Fixed-size ring buffer of quantized camera poses sampled at a fixed rate, for killcams and
+ * instant replay. Frames are 20 bytes: positions are delta-coded against an absolute key stored
+ * once per block, rotations are 16 bits per axis, FOV is 16 bits and layer weights 8 bits each.
+ * Everything is allocated in Initialize; 10 s at 30 Hz is about 7 KB per recorder.
+ *
+ * Frames are addressed by serial (frames recorded since Reset), so a reader can keep its place
+ * while recording continues.
+ */
+class CUSTOMCAMERA_API FCameraPoseRecorder
+{
+public:
+    static constexpr int32 BlockSize = 32;
+
+    // Position deltas are stored in 1/8 cm steps, i.e. up to ~40 m per frame
+    static constexpr float PositionScale = 8.0f;
+
+    /** Allocates room for at least Seconds of history at SampleRate frames per second */
+    void Initialize(float Seconds, float SampleRate);
+
+    /** Advances the sample clock by DeltaTime and writes a frame each time a sample is due */
+    void Record(float DeltaTime, const FCameraRecordedPose& Pose);
+
+    /** Drops every recorded frame; the allocation is kept */
+    void Reset();
+
+    bool IsInitialized() const { return Frames.Num() > 0; }
+    float GetSampleInterval() const { return SampleInterval; }
+
+    /** Oldest serial that can still be decoded, and one past the newest */
+    int64 GetFirstSerial() const;
+    int64 GetEndSerial() const { return NumWritten; }
+
+    /** Decodes the pose at a fractional serial, interpolating between neighbouring frames */
+    bool Sample(double Serial, FCameraRecordedPose& OutPose) const;
+
+    SIZE_T GetAllocatedSize() const { return Frames.GetAllocatedSize() + Keys.GetAllocatedSize(); }
+
+private:
+    struct FFrame
+    {
+        int16 Delta[3];
+        uint16 Rotation[3];
+        uint16 FieldOfView;
+        uint8 LayerWeights[FCameraPostProcessStack::NumLayers];
+    };
+
+    void WriteFrame(const FCameraRecordedPose& Pose);
+    void DecodeFrame(int64 Serial, FCameraRecordedPose& OutPose) const;
+
+    TArray<FFrame> Frames;
+
+    // Absolute location of the first frame of each block
+    TArray<FVector> Keys;
+
+    int64 NumWritten = 0;
+    float SampleInterval = 0.0f;
+    float TimeSinceSample = 0.0f;
+
+    // Location the decoder will reconstruct for the last frame; deltas are taken against it so
+    // quantization error never accumulates
+    FVector EncodedLocation = FVector::ZeroVector;
+};
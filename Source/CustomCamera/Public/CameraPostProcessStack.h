@@ -0,0 +1,82 @@
+// CameraPostProcessStack.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPostProcessSettings;
+class UMaterialInterface;
+
+// Layers are resolved bottom to top; a later layer blends over the result of the earlier ones by its weight
+enum class ECameraPostProcessLayer : uint8
+{
+    Base,
+    Occlusion,
+    DepthOfField,
+    MotionBlur,
+    Warp,
+    Fade,
+
+    Count
+};
+
+// Post-process fields the camera drives
+enum class ECameraPostProcessField : uint8
+{
+    DepthOfFieldFocalDistance,
+    DepthOfFieldFocalRegion,
+    DepthOfFieldFstop,
+    MotionBlurAmount,
+    VignetteIntensity,
+    ColorGradingIntensity,
+
+    Count
+};
+
+/**
+ * Camera-owned, layered post-process state. Layers only record values and weights; Push resolves
+ * them and writes into the camera's FPostProcessSettings just the fields and blendables that
+ * changed since the previous push, so an idle stack costs a single dirty check per frame.
+ */
+class CUSTOMCAMERA_API FCameraPostProcessStack
+{
+public:
+    static constexpr int32 NumLayers = static_cast<int32>(ECameraPostProcessLayer::Count);
+    static constexpr int32 NumFields = static_cast<int32>(ECameraPostProcessField::Count);
+
+    void SetLayerWeight(ECameraPostProcessLayer Layer, float Weight);
+    float GetLayerWeight(ECameraPostProcessLayer Layer) const;
+
+    void SetField(ECameraPostProcessLayer Layer, ECameraPostProcessField Field, float Value);
+    void ClearField(ECameraPostProcessLayer Layer, ECameraPostProcessField Field);
+
+    /** Sets the layer's blendable material; it is pushed with the layer's weight */
+    void SetBlendable(ECameraPostProcessLayer Layer, UMaterialInterface* Material);
+
+    /** Writes the changed fields into Settings; returns true if anything was written */
+    bool Push(FPostProcessSettings& Settings);
+
+    /** Clears every layer; the next push removes everything the stack had written */
+    void Reset();
+
+private:
+    struct FLayer
+    {
+        float Weight = 0.0f;
+        uint32 FieldMask = 0;
+        float Values[NumFields] = {};
+        TWeakObjectPtr<UMaterialInterface> Blendable;
+    };
+
+    static void WriteField(FPostProcessSettings& Settings, ECameraPostProcessField Field, bool bOverride, float Value);
+
+    FLayer Layers[NumLayers];
+
+    // What the last push wrote
+    uint32 PushedMask = 0;
+    float PushedValues[NumFields] = {};
+    TWeakObjectPtr<UMaterialInterface> PushedBlendables[NumLayers];
+    float PushedBlendableWeights[NumLayers] = {};
+
+    bool bDirty = false;
+};
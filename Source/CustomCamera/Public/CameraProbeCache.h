@@ -0,0 +1,52 @@
+// CameraProbeCache.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/HitResult.h"
+
+class UPrimitiveComponent;
+
+/**
+ * Temporal-coherence cache for a single camera probe. A stored result is reused while the probe
+ * start, direction and owner location stay within the configured epsilons, no tracked dynamic
+ * primitive has moved and the entry is younger than MaxAge. Nothing is tracked for a miss, so
+ * misses use the much shorter MissMaxAge.
+ */
+class CUSTOMCAMERA_API FCameraProbeCache
+{
+public:
+    void Configure(float InLocationEpsilon, float InAngleEpsilonDegrees, float InMaxAge, float InMissMaxAge);
+
+    /** Returns true and fills the outputs when the cached result is still valid for this query */
+    bool TryGet(const FVector& Start, const FVector& Direction, const FVector& OwnerLocation, float WorldTime, FHitResult& OutHit, bool& bOutBlockingHit) const;
+
+    /** Stores a fresh result; a movable blocking primitive is tracked so its movement invalidates the entry */
+    void Store(const FVector& Start, const FVector& Direction, const FVector& OwnerLocation, float WorldTime, const FHitResult& Hit, bool bBlockingHit);
+
+    void Invalidate();
+
+private:
+    bool HasTrackedPrimitiveMoved() const;
+
+    struct FTrackedPrimitive
+    {
+        TWeakObjectPtr<UPrimitiveComponent> Component;
+        FTransform Transform;
+    };
+
+    float LocationEpsilonSquared = 1.0f;
+    float MinDirectionDot = 0.99996f;
+    float MaxAge = 0.5f;
+    float MissMaxAge = 0.05f;
+
+    bool bValid = false;
+    FVector CachedStart = FVector::ZeroVector;
+    FVector CachedDirection = FVector::ForwardVector;
+    FVector CachedOwnerLocation = FVector::ZeroVector;
+    float CachedTime = 0.0f;
+    bool bCachedBlockingHit = false;
+    FHitResult CachedHit;
+
+    TArray<FTrackedPrimitive, TInlineAllocator<4>> TrackedPrimitives;
+};
@@ -0,0 +1,99 @@
+// CameraQueryBatcher.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "CollisionQueryParams.h"
+#include "CollisionShape.h"
+#include "WorldCollision.h"
+
+class UWorld;
+class AActor;
+
+// Scene probes a camera can issue in a frame
+enum class ECameraProbe : uint8
+{
+    Collision,
+    Terrain,
+    Transparency,
+    CollisionPrediction,
+    ObstacleDetection,
+    Autofocus,
+    Framing
+};
+
+struct FCameraProbeResult
+{
+    ECameraProbe Probe = ECameraProbe::Collision;
+    uint8 Index = 0;
+
+    // True when the result was harvested (or traced synchronously) this frame
+    bool bReady = false;
+    bool bBlockingHit = false;
+
+    // TraceStart and TraceEnd are the requested path even when nothing was hit
+    FHitResult Hit;
+};
+
+/**
+ * Collects every scene query a camera wants this frame and submits them together through
+ * the world's async trace interface. Results are harvested at the start of the next frame.
+ * Probes that cannot tolerate a frame of latency use TraceSync instead.
+ */
+class CUSTOMCAMERA_API FCameraQueryBatcher
+{
+public:
+    /** Sets up the shared query params; IgnoredActor is usually the camera owner */
+    void Initialize(AActor* IgnoredActor);
+
+    /** Harvests the results of the queries submitted last frame. Call once at the start of the camera update. */
+    void BeginFrame(UWorld* World);
+
+    /** Submits every query requested since the last flush. Call once at the end of the camera update. */
+    void Flush(UWorld* World);
+
+    void RequestLineTrace(ECameraProbe Probe, const FVector& Start, const FVector& End, ECollisionChannel Channel, uint8 Index = 0);
+    void RequestSweep(ECameraProbe Probe, const FVector& Start, const FVector& End, const FCollisionShape& Shape, ECollisionChannel Channel, uint8 Index = 0);
+
+    /** Synchronous fallback for probes that must not lag; the result is also available through GetResult */
+    bool TraceSync(UWorld* World, ECameraProbe Probe, const FVector& Start, const FVector& End, ECollisionChannel Channel, FHitResult& OutHit, uint8 Index = 0);
+
+    /** Returns the result that became available this frame, or nullptr if none did */
+    const FCameraProbeResult* GetResult(ECameraProbe Probe, uint8 Index = 0) const;
+
+    /** Drops all pending, in-flight and harvested queries */
+    void Reset();
+
+    /** Queries whose results weren't ready in the frame after submission, since the last Reset; consumers keep their last result meanwhile */
+    int32 GetNumDroppedQueries() const { return NumDroppedQueries; }
+
+private:
+    struct FPendingQuery
+    {
+        ECameraProbe Probe;
+        uint8 Index;
+        FVector Start;
+        FVector End;
+        FCollisionShape Shape;
+        ECollisionChannel Channel;
+        bool bSweep;
+    };
+
+    struct FInFlightQuery
+    {
+        ECameraProbe Probe;
+        uint8 Index;
+        FTraceHandle Handle;
+    };
+
+    FCameraProbeResult& FindOrAddResult(ECameraProbe Probe, uint8 Index);
+
+    FCollisionQueryParams QueryParams;
+
+    TArray<FPendingQuery, TInlineAllocator<16>> PendingQueries;
+    TArray<FInFlightQuery, TInlineAllocator<16>> InFlightQueries;
+    TArray<FCameraProbeResult, TInlineAllocator<16>> Results;
+
+    int32 NumDroppedQueries = 0;
+};
@@ -0,0 +1,65 @@
+// CameraRailActor.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "CameraRailTable.h"
+#include "CameraRailActor.generated.h"
+
+class USplineComponent;
+class UCurveFloat;
+
+/**
+ * Cinematic camera rail placed in the level. Owns the baked FCameraRailTable that every camera
+ * riding it samples; the rail is static, so the table is built once at BeginPlay (and on edit).
+ */
+UCLASS()
+class CUSTOMCAMERA_API ACameraRailActor : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    ACameraRailActor();
+
+    virtual void OnConstruction(const FTransform& Transform) override;
+
+protected:
+    virtual void BeginPlay() override;
+
+public:
+    /** Rebakes the table, e.g. after moving the rail or editing its splines at runtime */
+    UFUNCTION(BlueprintCallable, Category = "Camera|Rail")
+    void RebuildTable();
+
+    const FCameraRailTable& GetTable() const { return Table; }
+
+    // Path the camera travels
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera|Rail")
+    USplineComponent* Path;
+
+    // Optional path the camera looks at, walked in step with Path; the camera looks along Path when disabled
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera|Rail")
+    USplineComponent* LookAtPath;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Rail")
+    bool bUseLookAtPath;
+
+    // FOV over normalized distance along the rail (0..1); DefaultFOV is used when unset
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Rail")
+    UCurveFloat* FOVCurve;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Rail")
+    float DefaultFOV;
+
+    // Constant travel speed along the rail (cm/s)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Rail", meta = (ClampMin = "0.0"))
+    float Speed;
+
+    // Distance between baked samples (cm); smaller is smoother on tight curves and costs memory only
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Rail", meta = (ClampMin = "1.0"))
+    float SampleSpacing;
+
+private:
+    FCameraRailTable Table;
+};
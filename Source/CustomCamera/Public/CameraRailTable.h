@@ -0,0 +1,49 @@
+// CameraRailTable.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class USplineComponent;
+class UCurveFloat;
+
+// A rail pose sampled at some distance along the rail, in world space
+struct FCameraRailSample
+{
+    FVector Location = FVector::ZeroVector;
+    FRotator Rotation = FRotator::ZeroRotator;
+    float FieldOfView = 90.0f;
+};
+
+/**
+ * Arc-length reparameterized rail. Position, look-at and FOV tracks are baked once at a fixed
+ * distance spacing, so sampling at any distance is an index and a lerp instead of a search of
+ * the spline's parameter table. Immutable after Build; any number of cameras can sample it.
+ */
+class CUSTOMCAMERA_API FCameraRailTable
+{
+public:
+    /**
+     * Bakes the tracks. LookAtPath is walked at the same normalized distance as Path; without it
+     * the rail looks along its own tangent. FOVCurve is keyed by normalized distance (0..1).
+     */
+    void Build(const USplineComponent& Path, const USplineComponent* LookAtPath, const UCurveFloat* FOVCurve, float DefaultFOV, float SampleSpacing);
+
+    /** O(1): Distance is clamped, or wrapped when the rail is a closed loop */
+    FCameraRailSample Sample(float Distance) const;
+
+    float GetLength() const { return Length; }
+    bool IsClosedLoop() const { return bClosedLoop; }
+    bool IsValid() const { return Locations.Num() >= 2; }
+
+    void Reset();
+
+private:
+    TArray<FVector> Locations;
+    TArray<FQuat> Rotations;
+    TArray<float> FieldsOfView;
+
+    float Length = 0.0f;
+    float InvSpacing = 0.0f;
+    bool bClosedLoop = false;
+};
@@ -17,3 +17,50 @@ enum class ECameraShakeAction : uint8
     Damage UMETA(DisplayName = "Damage"),
     Death UMETA(DisplayName = "Death")
 };
+
+UENUM(BlueprintType)
+enum class ECameraShakeWaveform : uint8
+{
+    Perlin UMETA(DisplayName = "Perlin"),
+    Sine UMETA(DisplayName = "Sine")
+};
+
+USTRUCT(BlueprintType)
+struct FCameraShakeParams
+{
+    GENERATED_BODY()
+
+    // Peak rotation in degrees
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CameraShake|Parameters")
+    float Intensity;
+
+    // Oscillations per second
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CameraShake|Parameters")
+    float Frequency;
+
+    // Adds to the shakes already playing; otherwise replaces them
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CameraShake|Parameters")
+    bool bAdditive;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CameraShake|Parameters", meta = (ClampMin = "0.01"))
+    float Duration;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CameraShake|Parameters")
+    ECameraShakeWaveform Waveform;
+
+    FCameraShakeParams()
+        : Intensity(1.0f), Frequency(10.0f), bAdditive(false), Duration(0.25f), Waveform(ECameraShakeWaveform::Perlin) {
+    }
+};
+
+USTRUCT(BlueprintType)
+struct FCameraShakeMapping
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CameraShake")
+    ECameraShakeAction Action;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CameraShake")
+    FCameraShakeParams ShakeParams;
+};
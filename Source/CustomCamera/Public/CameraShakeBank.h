@@ -0,0 +1,54 @@
+// CameraShakeBank.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CameraShakeAction.h"
+
+/**
+ * Procedural shakes for the local camera. A fixed number of oscillator lanes is stored as plain
+ * arrays and all of them are evaluated together in one SIMD loop, so triggering a shake never
+ * allocates and an idle bank costs a single check.
+ */
+class CUSTOMCAMERA_API FCameraShakeBank
+{
+public:
+    // Multiple of 4, the loop handles four lanes per step
+    static constexpr int32 Capacity = 8;
+    static constexpr int32 NumActions = static_cast<int32>(ECameraShakeAction::Death) + 1;
+
+    FCameraShakeBank();
+
+    /** Builds the per-action lookup table; later mappings for the same action win */
+    void BuildActionTable(const TArray<FCameraShakeMapping>& Mappings);
+
+    /** Plays the shake mapped to Action; returns false if the action has none */
+    bool PlayAction(ECameraShakeAction Action, float Scale = 1.0f);
+    void Play(const FCameraShakeParams& Params, float Scale = 1.0f);
+
+    /** Advances every lane by DeltaTime and returns the summed rotation offset */
+    FRotator Evaluate(float DeltaTime);
+
+    void StopAll();
+    bool IsActive() const { return ActiveMask != 0; }
+
+private:
+    int32 FindLane() const;
+
+    // Oscillator lanes; an inactive lane has zero amplitude
+    alignas(16) float Amplitude[Capacity];
+    alignas(16) float Frequency[Capacity];
+    alignas(16) float Elapsed[Capacity];
+    alignas(16) float InvDuration[Capacity];
+    alignas(16) float PerlinWeight[Capacity];
+
+    // Per-axis (pitch, yaw, roll) offsets so the axes don't move in lockstep
+    alignas(16) float AxisSeed[3][Capacity];
+
+    uint32 ActiveMask;
+
+    FCameraShakeParams ActionParams[NumActions];
+    bool bHasActionParams[NumActions];
+
+    FRandomStream SeedStream;
+};
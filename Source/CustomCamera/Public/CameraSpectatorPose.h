@@ -0,0 +1,157 @@
+// CameraSpectatorPose.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/NetSerialization.h"
+#include "CameraSpectatorPose.generated.h"
+
+/**
+ * Final camera pose as spectators receive it: location to 1 cm, 16-bit rotation axes and FOV
+ * to a quarter degree. Replicated as a property, so the engine only resends it to a connection
+ * when it differs from what that connection acknowledged.
+ */
+USTRUCT()
+struct CUSTOMCAMERA_API FCameraSpectatorPose
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FVector Location = FVector::ZeroVector;
+
+    UPROPERTY()
+    FRotator Rotation = FRotator::ZeroRotator;
+
+    UPROPERTY()
+    float FieldOfView = 90.0f;
+
+    /** Rounds to exactly what NetSerialize transmits, so both ends agree on the pose */
+    void Quantize();
+
+    bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FCameraSpectatorPose> : public TStructOpsTypeTraitsBase2<FCameraSpectatorPose>
+{
+    enum
+    {
+        WithNetSerializer = true,
+    };
+};
+
+/**
+ * Owner-to-server pose update. The location is sent as a variable-length delta against the
+ * newest pose the server acknowledged, or absolute when there is no usable acknowledgement.
+ */
+USTRUCT()
+struct CUSTOMCAMERA_API FCameraSpectatorPosePacket
+{
+    GENERATED_BODY()
+
+    uint8 Sequence = 0;
+
+    // Only meaningful with bHasBase
+    uint8 BaseSequence = 0;
+    bool bHasBase = false;
+
+    // Whole centimetres against the base location when bHasBase, otherwise unused
+    FIntVector LocationDelta = FIntVector::ZeroValue;
+
+    // Absolute location when !bHasBase
+    FVector Location = FVector::ZeroVector;
+
+    FRotator Rotation = FRotator::ZeroRotator;
+    float FieldOfView = 90.0f;
+
+    bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FCameraSpectatorPosePacket> : public TStructOpsTypeTraitsBase2<FCameraSpectatorPosePacket>
+{
+    enum
+    {
+        WithNetSerializer = true,
+    };
+};
+
+struct FCameraSpectatorSendSettings
+{
+    // Fastest and slowest send rates; between them a send is due once the pose moved past a threshold
+    float MinSendInterval = 0.1f;
+    float MaxSendInterval = 1.0f;
+
+    float LocationThreshold = 2.0f;
+    float RotationThreshold = 0.5f;
+    float FOVThreshold = 0.5f;
+};
+
+/** Owning client: decides when to send and builds delta packets against acknowledged poses */
+class CUSTOMCAMERA_API FCameraSpectatorPoseSender
+{
+public:
+    static constexpr int32 HistorySize = 16;
+
+    /** Returns true and fills OutPacket when a send is due; Pose is quantized in place */
+    bool Update(float DeltaTime, FCameraSpectatorPose& Pose, const FCameraSpectatorSendSettings& Settings, FCameraSpectatorPosePacket& OutPacket);
+
+    void Acknowledge(uint8 Sequence);
+    void Reset();
+
+private:
+    // Quantized poses by sequence, as the server decoded them
+    FCameraSpectatorPose Sent[HistorySize];
+
+    float TimeSinceSend = 0.0f;
+    uint8 NextSequence = 0;
+    uint8 AckedSequence = 0;
+    bool bHasAck = false;
+    bool bHasSent = false;
+};
+
+/** Server: decodes packets against the poses it received (and acknowledged) before */
+class CUSTOMCAMERA_API FCameraSpectatorPoseReceiver
+{
+public:
+    /** Returns false for packets that are out of order or whose base is no longer known */
+    bool Decode(const FCameraSpectatorPosePacket& Packet, FCameraSpectatorPose& OutPose);
+
+    void Reset();
+
+private:
+    FCameraSpectatorPose Received[FCameraSpectatorPoseSender::HistorySize];
+    uint8 ReceivedSequence[FCameraSpectatorPoseSender::HistorySize] = {};
+    bool bReceived[FCameraSpectatorPoseSender::HistorySize] = {};
+
+    uint8 LatestSequence = 0;
+    bool bHasLatest = false;
+};
+
+/** Spectator: buffers received poses and plays them back a fixed delay behind arrival */
+class CUSTOMCAMERA_API FCameraSpectatorPoseInterpolator
+{
+public:
+    static constexpr int32 Capacity = 8;
+
+    /** Adds a pose received at Time. A pose the sender held for longer than HoldInterval is treated as held until just before this one */
+    void Push(const FCameraSpectatorPose& Pose, double Time, float HoldInterval);
+
+    bool Sample(double Time, FCameraSpectatorPose& OutPose) const;
+
+    bool IsEmpty() const { return Num == 0; }
+    void Reset();
+
+private:
+    struct FSnapshot
+    {
+        FCameraSpectatorPose Pose;
+        double Time = 0.0;
+    };
+
+    const FSnapshot& Get(int32 Age) const { return Snapshots[(Head - Age + Capacity) % Capacity]; }
+
+    FSnapshot Snapshots[Capacity];
+    int32 Head = 0;
+    int32 Num = 0;
+};
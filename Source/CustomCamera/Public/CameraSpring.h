@@ -0,0 +1,64 @@
+// CameraSpring.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Critically damped springs solved exactly in DeltaTime: stepping once by 2*dt or twice by dt
+ * lands on the same value, so the camera settles identically at any frame rate. Value and
+ * Velocity are the spring's state and must be carried between updates.
+ */
+namespace CameraSpring
+{
+    /** Half-life of a spring that settles in about the time FInterpTo at Speed does; 0 snaps */
+    inline float HalfLifeFromSpeed(float Speed)
+    {
+        return Speed > 0.0f ? UE_LN2 / Speed : 0.0f;
+    }
+
+    inline void CriticallyDamped(float& Value, float& Velocity, float Goal, float HalfLife, float DeltaTime)
+    {
+        if (HalfLife <= 0.0f)
+        {
+            Value = Goal;
+            Velocity = 0.0f;
+            return;
+        }
+
+        const float Y = 2.0f * UE_LN2 / HalfLife;
+        const float J0 = Value - Goal;
+        const float J1 = Velocity + J0 * Y;
+        const float Decay = FMath::Exp(-Y * DeltaTime);
+        Value = Decay * (J0 + J1 * DeltaTime) + Goal;
+        Velocity = Decay * (Velocity - J1 * Y * DeltaTime);
+    }
+
+    inline void CriticallyDamped(FVector& Value, FVector& Velocity, const FVector& Goal, float HalfLife, float DeltaTime)
+    {
+        if (HalfLife <= 0.0f)
+        {
+            Value = Goal;
+            Velocity = FVector::ZeroVector;
+            return;
+        }
+
+        const float Y = 2.0f * UE_LN2 / HalfLife;
+        const FVector J0 = Value - Goal;
+        const FVector J1 = Velocity + J0 * Y;
+        const float Decay = FMath::Exp(-Y * DeltaTime);
+        Value = (J0 + J1 * DeltaTime) * Decay + Goal;
+        Velocity = (Velocity - J1 * (Y * DeltaTime)) * Decay;
+    }
+
+    /** Per axis, towards the nearest equivalent of Goal so the spring never takes the long way round */
+    inline void CriticallyDamped(FRotator& Value, FRotator& Velocity, const FRotator& Goal, float HalfLife, float DeltaTime)
+    {
+        const FRotator Unwound = Value + (Goal - Value).GetNormalized();
+        FVector Axes(Value.Pitch, Value.Yaw, Value.Roll);
+        FVector AxesVelocity(Velocity.Pitch, Velocity.Yaw, Velocity.Roll);
+        CriticallyDamped(Axes, AxesVelocity, FVector(Unwound.Pitch, Unwound.Yaw, Unwound.Roll), HalfLife, DeltaTime);
+        Value = FRotator(Axes.X, Axes.Y, Axes.Z).GetNormalized();
+        Velocity = FRotator(AxesVelocity.X, AxesVelocity.Y, AxesVelocity.Z);
+    }
+}
@@ -3,60 +3,36 @@
 #include "CoreMinimal.h"
 #include "Camera/CameraComponent.h"
 #include "CameraShakeAction.h" // Ensure this header defines ECameraShakeAction
+#include "CameraPose.h"
+#include "CameraQueryBatcher.h"
+#include "CameraProbeCache.h"
+#include "CameraOcclusionFader.h"
+#include "CameraOccluderTracker.h"
+#include "CameraMaterialPool.h"
+#include "CameraEffectTimeline.h"
+#include "CameraPostProcessStack.h"
+#include "CameraHotState.h"
+#include "CameraShakeBank.h"
+#include "CameraModeStack.h"
+#include "CameraPoseRecorder.h"
+#include "CameraSpectatorPose.h"
+#include "CameraFramingSet.h"
 #include "Sound/SoundBase.h"
-#include "Components/AudioComponent.h"
 #include "Materials/MaterialInterface.h"
 #include "TimerManager.h"
-#include "Engine/PostProcessVolume.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Camera/CameraShakeBase.h"
 #include "CustomCameraComponent.generated.h"
 
 // Forward Declarations
-class APostProcessVolume;
 class UMaterialInstanceDynamic;
-class UAudioComponent;
 class UCameraShakeBase;
-
-UENUM(BlueprintType)
-enum class ECameraMode : uint8
-{
-    ThirdPerson UMETA(DisplayName = "Third Person"),
-    FirstPerson UMETA(DisplayName = "First Person"),
-    FreeCamera UMETA(DisplayName = "Free Camera"),
-    Cinematic UMETA(DisplayName = "Cinematic")
-};
-
-USTRUCT(BlueprintType)
-struct FCameraShakeParams
-{
-    GENERATED_BODY()
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CameraShake|Parameters")
-    float Intensity;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CameraShake|Parameters")
-    float Frequency;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CameraShake|Parameters")
-    bool bAdditive;
-
-    FCameraShakeParams()
-        : Intensity(1.0f), Frequency(10.0f), bAdditive(false) {
-    }
-};
-
-USTRUCT(BlueprintType)
-struct FCameraShakeMapping
-{
-    GENERATED_BODY()
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CameraShake")
-    ECameraShakeAction Action;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CameraShake")
-    FCameraShakeParams ShakeParams;
-};
+class UCurveFloat;
+class AController;
+class UCustomCameraSubsystem;
+class ACameraRailActor;
+class ACameraHintVolume;
+class UCustomCameraProfile;
 
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class CUSTOMCAMERA_API UCustomCameraComponent : public UCameraComponent
@@ -67,10 +43,37 @@ public:
     UCustomCameraComponent();
 
 protected:
+    virtual void OnRegister() override;
+    virtual void OnUnregister() override;
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+    virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+
+    /** Game thread: harvests probes, gathers the frame input and copies hot state into Hot at Index */
+    void GatherCameraUpdate(float DeltaTime, FCameraHotStateArrays& Hot, int32 Index);
+
+    /** Game thread: takes the evaluated hot state back, runs the scene modifiers and commits the pose */
+    void ApplyCameraUpdate(const FCameraHotStateArrays& Hot, int32 Index);
+
+    /** Enables or disables camera updates for the owner's current net mode, role and controller */
+    UFUNCTION(BlueprintCallable, Category = "Camera")
+    void RefreshNetRoleGating();
+
+    // **Profile**
+    // Shared tuning; every camera using the same profile reads the same asset. Class defaults when unset
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera")
+    UCustomCameraProfile* Profile;
+
+    UFUNCTION(BlueprintCallable, Category = "Camera")
+    void SetProfile(UCustomCameraProfile* NewProfile);
+
+    const UCustomCameraProfile& GetProfile() const { return *Tuning; }
 
     // **Camera Modes**
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Modes")
@@ -94,6 +97,19 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Camera|Modes")
     void SwitchToCinematic();
 
+    /** Overrides the base FOV the dynamic FOV modifiers work from, until the blended mode FOV next changes */
+    UFUNCTION(BlueprintCallable, Category = "Camera|Modes")
+    void SetCustomFOV(float NewFOV);
+
+    // **Cinematic Rails**
+    // Rail the cinematic mode rides; without one the cinematic mode holds the shot it was entered with
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Cinematic")
+    ACameraRailActor* CinematicRail;
+
+    /** Switches to the cinematic mode riding Rail from StartDistance (cm along the rail) */
+    UFUNCTION(BlueprintCallable, Category = "Camera|Cinematic")
+    void PlayCinematicRail(ACameraRailActor* Rail, float StartDistance = 0.0f);
+
     // **Aiming and Running**
     UFUNCTION(BlueprintCallable, Category = "Camera|Aiming")
     void StartAiming();
@@ -160,268 +176,73 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Camera|WarpEffect")
     void BeginWarpEffect();
 
-    // **Transitions**
-    UFUNCTION(BlueprintCallable, Category = "Camera|Transition")
-    void SmoothTransitionToTarget(FVector TargetPosition, float TargetFOV, float Duration);
-
-    UFUNCTION(BlueprintCallable, Category = "Camera|Transition")
-    void InstantTransitionToTarget(FVector TargetPosition, float TargetFOV);
-
-    // **AAA Features**
-    // Dynamic Obstacle Detection
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|AAA Features|Dynamic Obstacle Detection")
-    bool bEnableDynamicObstacleDetection;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|AAA Features|Dynamic Obstacle Detection", meta = (EditCondition = "bEnableDynamicObstacleDetection"))
-    float ObstacleDetectionInterval;
-
-    // Dynamic Zoom
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|AAA Features|Dynamic Zoom")
-    bool bEnableDynamicZoom;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|AAA Features|Dynamic Zoom", meta = (EditCondition = "bEnableDynamicZoom"))
-    float DynamicZoomThreshold;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|AAA Features|Dynamic Zoom", meta = (EditCondition = "bEnableDynamicZoom"))
-    float DynamicZoomSpeed;
-
-    // Contextual Positioning
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|AAA Features|Contextual Positioning")
-    bool bEnableContextualPositioning;
-
-    // Intelligent Framing
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|AAA Features|Intelligent Framing")
-    bool bEnableIntelligentFraming;
-
-    // Adaptive Depth of Field
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|AAA Features|Adaptive Depth of Field")
-    bool bEnableAdaptiveDepthOfField;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|AAA Features|Adaptive Depth of Field", meta = (EditCondition = "bEnableAdaptiveDepthOfField"))
-    float FocusDistance;
-
-    // Collision Prediction
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|AAA Features|Collision Prediction")
-    bool bEnableCollisionPrediction;
-
-    // Environmental Awareness
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|AAA Features|Environmental Awareness")
-    bool bEnableEnvironmentalAwareness;
-
-    // Focus-based FOV
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|AAA Features|Focus-based FOV")
-    bool bEnableFocusBasedFOV;
-
-    // Advanced Motion Blur
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|AAA Features|Advanced Motion Blur")
-    bool bEnableAdvancedMotionBlur;
-
-    // Camera Inertia
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|AAA Features|Inertia")
-    bool bEnableCameraInertia;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|AAA Features|Inertia", meta = (EditCondition = "bEnableCameraInertia"))
-    float CameraInertiaStrength;
-
-    // **Additional Variables**
-
-    // Head Bobbing Settings
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|HeadBobbing")
-    bool bEnableHeadBobbing;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|HeadBobbing")
-    float RunningBobMagnitude;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|HeadBobbing")
-    float WalkingBobMagnitude;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|HeadBobbing")
-    float BobFrequency;
-
-    // Camera Sway Settings
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Sway")
-    bool bEnableCameraSway;
+    // **Framing**
+    // Frames Target together with the owner and the other targets; returns false once 32 targets are framed
+    UFUNCTION(BlueprintCallable, Category = "Camera|Framing")
+    bool AddFramingTarget(AActor* Target, float Radius = 50.0f);
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Sway")
-    float SwayAmount;
+    UFUNCTION(BlueprintCallable, Category = "Camera|Framing")
+    bool RemoveFramingTarget(AActor* Target);
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Sway")
-    float SwaySpeed;
+    UFUNCTION(BlueprintCallable, Category = "Camera|Framing")
+    void ClearFramingTargets();
 
-    // Rotation Settings
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Rotation")
-    float MaxYawRotation;
+    // **Camera Hints**
+    /** Camera hint volume the owner stood in at the last update, or null */
+    const ACameraHintVolume* GetActiveCameraHint() const { return ActiveHint.Get(); }
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Rotation")
-    float MaxPitchRotation;
+    // Drops cached probe results, e.g. after moving level geometry the cache can't observe
+    UFUNCTION(BlueprintCallable, Category = "Camera|Collision")
+    void InvalidateProbeCache();
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Rotation")
-    float RotationSpeed;
+    // **Pose Replay**
+    /** Drives this camera from Source's recording (this camera's own when null), starting SecondsBack before its newest frame */
+    UFUNCTION(BlueprintCallable, Category = "Camera|Replay")
+    void StartPoseReplay(UCustomCameraComponent* Source, float SecondsBack, float PlayRate = 1.0f);
 
-    // Terrain Tilt
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Tilt")
-    bool bEnableTerrainTilt;
+    UFUNCTION(BlueprintCallable, Category = "Camera|Replay")
+    void StopPoseReplay();
 
-    // Camera Lag
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Lag")
-    bool bEnableCameraLag;
+    UFUNCTION(BlueprintCallable, Category = "Camera|Replay")
+    bool IsReplayingPoses() const { return bReplayingPoses; }
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Lag")
-    float CameraLagSpeed;
+    const FCameraPoseRecorder& GetPoseRecorder() const { return PoseRecorder; }
 
-    // Dynamic FOV
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|FOV")
-    bool bEnableDynamicFOV;
+    // **Spectating**
+    /** Spectators: moves this (remote player's) camera to the interpolated replicated pose; false once the local player stops viewing it */
+    bool UpdateSpectatorView(double WorldTime);
 
-    // Camera Height Constraints
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Collision")
-    float MinCameraHeight;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Collision")
-    float MaxCameraHeight;
-
-    // **Additional Materials**
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Effects")
-    UMaterialInterface* FadeMaterial;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Effects")
-    UMaterialInterface* OcclusionMaterial;
-
-    // NEW: Transparent Material for dynamic transparency
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Occlusion")
-    UMaterialInterface* TransparentMaterial;
-
-    // **Camera Positions**
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Positions")
-    FVector FirstPersonPosition;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Positions")
-    FVector ThirdPersonPosition;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Positions")
-    FVector AimPositionFirstPerson;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Positions")
-    FVector AimPositionThirdPerson;
-
-    // **FOV Settings**
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|FOV")
-    float DefaultFOV;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|FOV")
-    float AimingFOV;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|FOV")
-    float TransitionSpeed;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|FOV")
-    float ZoomedFOV;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|FOV")
-    float SprintFOV;
-
-    // **PostProcess Settings**
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|PostProcess")
-    UMaterialInterface* PostProcessMaterial;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|PostProcess")
-    APostProcessVolume* PostProcessVolume;
-
-    // Depth of Field
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|PostProcess")
-    float DepthOfField;
-
-    // Motion Blur Amount
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|PostProcess")
-    float MotionBlurAmount;
-
-    // Color Grading Intensity
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|PostProcess")
-    float ColorGradingIntensity;
-
-    // Vignette Intensity
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|PostProcess")
-    float VignetteIntensity;
-
-    // **Audio Settings for Warp Effect**
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|WarpEffect")
-    USoundBase* WarpSoundEffect;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|WarpEffect")
-    float WarpSoundVolumeMultiplier;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|WarpEffect")
-    float WarpSoundPitchMultiplier;
-
-    // **Warp Effect Parameters**
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|WarpEffect")
-    float WarpMaxFOVIncrease;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|WarpEffect")
-    float WarpDuration;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|WarpEffect")
-    float WarpVignetteIntensity;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|WarpEffect")
-    float WarpMotionBlurAmount;
-
-    // **Camera Shakes**
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Shake")
-    TArray<FCameraShakeMapping> CameraShakeMappings;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Shake")
-    TSubclassOf<UCameraShakeBase> CameraShakeClass;
+    // **Transitions**
+    // Blends the current mode to TargetPosition/TargetFOV; the next mode switch blends away from it
+    UFUNCTION(BlueprintCallable, Category = "Camera|Transition")
+    void SmoothTransitionToTarget(FVector TargetPosition, float TargetFOV, float Duration);
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Repositioning", meta = (EditCondition = "bEnableOverShoulderRepositioning"))
-    float RepositioningSpeed;
+    UFUNCTION(BlueprintCallable, Category = "Camera|Transition")
+    void InstantTransitionToTarget(FVector TargetPosition, float TargetFOV);
 
     // **Timer Handles**
     FTimerHandle ObstacleDetectionTimerHandle;
-    FTimerHandle FadeTimerHandle;
-    FTimerHandle FadeInterpolationHandle;
-    FTimerHandle WarpTimerHandle;
 
 private:
-    // Dynamic Object Transparency
-    UPROPERTY(EditAnywhere, Category = "Camera|Occlusion")
-    bool bEnableDynamicObjectTransparency;
+    // Profile in use: Profile, or the class defaults when none is assigned. Never null
+    const UCustomCameraProfile* Tuning;
 
-    UPROPERTY(EditAnywhere, Category = "Camera|Occlusion", meta = (EditCondition = "bEnableDynamicObjectTransparency"))
-    float OcclusionTransparencyStrength;
+    // Tuning's feature toggles, rebuilt whenever the profile is applied
+    ECameraHotFeature EnabledFeatures;
 
-    UPROPERTY(EditAnywhere, Category = "Camera|Occlusion", meta = (EditCondition = "bEnableDynamicObjectTransparency"))
-    float OcclusionCheckDistance;
+#if WITH_EDITOR
+    FDelegateHandle ProfileChangedHandle;
+    void OnProfileChanged(const UCustomCameraProfile* ChangedProfile);
+#endif
 
-    TMap<UPrimitiveComponent*, UMaterialInterface*> OccludedComponents;
+    /** Resolves Tuning and re-applies the settings that are baked into runtime structures */
+    void ApplyProfile();
 
-    // Over-the-Shoulder Repositioning
-    UPROPERTY(EditAnywhere, Category = "Camera|Repositioning")
-    bool bEnableOverShoulderRepositioning;
-
-    UPROPERTY(EditAnywhere, Category = "Camera|Repositioning", meta = (EditCondition = "bEnableOverShoulderRepositioning"))
-    FVector OverShoulderOffset;
-
-    // Recoil System
-    UPROPERTY(EditAnywhere, Category = "Camera|Recoil")
-    bool bEnableRecoil;
-
-    UPROPERTY(EditAnywhere, Category = "Camera|Recoil", meta = (EditCondition = "bEnableRecoil"))
-    float RecoilIntensity;
-
-    UPROPERTY(EditAnywhere, Category = "Camera|Recoil", meta = (EditCondition = "bEnableRecoil"))
-    float RecoilRecoverySpeed;
+    FCameraOcclusionFader OcclusionFader;
+    FCameraOccluderTracker OccluderTracker;
 
     FRotator RecoilRotation;
 
-    // Environmental Awareness
-    UPROPERTY(EditAnywhere, Category = "Camera|Environment", meta = (EditCondition = "bEnableEnvironmentalAwareness"))
-    float EnvironmentCheckDistance;
-
-    // Advanced Motion Blur
-    UPROPERTY(EditAnywhere, Category = "Camera|MotionBlur", meta = (EditCondition = "bEnableAdvancedMotionBlur"))
-    float MotionBlurIntensityMultiplier;
-
     // **Dynamic Material Instances**
     UPROPERTY()
     UMaterialInstanceDynamic* FadeMaterialInstance;
@@ -429,68 +250,261 @@ private:
     UPROPERTY()
     UMaterialInstanceDynamic* OcclusionMaterialInstance;
 
-    // **Audio Components**
     UPROPERTY()
-    UAudioComponent* WarpAudioComponent;
+    UMaterialInstanceDynamic* PostProcessMaterialInstance;
+
+    // Fade/occlusion effects reuse these instead of creating a new MID per application
+    UPROPERTY()
+    FCameraMaterialInstancePool MaterialInstancePool;
 
     // **Camera State Flags**
     bool bIsRunning;
     bool bIsAiming;
     bool bIsFirstPersonMode;
-    bool bIsTransitioning;
-
-    // **Transition Variables**
-    float TransitionElapsedTime;
-    float TransitionTotalDuration;
-    FVector TransitionStartPosition;
-    FVector TransitionTargetPosition;
-    float TransitionStartFOV;
-    float TransitionTargetFOV;
 
     // **Current Rotation**
     FRotator CurrentRotation;
 
-    // **Warp Effect Variables**
-    float WarpElapsedTime;
-    float WarpTotalDuration;
-    float OriginalFOV;
-    float WarpStartFOV;
-    float WarpEndFOV;
+    // **Camera Mode Stack**
+    FCameraModeStack ModeStack;
+
+    // Anchors read by the free camera and cinematic evaluators
+    FVector FreeCameraLocation;
+    FVector CinematicLocation;
+    FRotator CinematicRotation;
+    float CinematicFOV;
+    float CinematicRailDistance;
+
+    // **Pose Pipeline State**
+    // Base pose the modifiers start from, evaluated by the mode stack during gather
+    FCameraPoseAccumulator PendingModePose;
+
+    // FOV arbitration state; reset to the mode FOV whenever the blended mode FOV changes
+    float BaseFOV;
+    float LastModeFOV;
+
+    // Smoothed per-feature contributions carried between frames
+    FVector ShoulderOffset;
+    FVector ObstacleOffset;
+    FRotator InertiaRotation;
+    FRotator FramingRotation;
+    FRotator TerrainTilt;
+    float BobPhase;
+    float SwayPhase;
+
+    // Spring velocities and fixed-step bookkeeping for the batched simulation
+    FCameraHotSprings SimulationSprings;
+    float SimulationAccumulator;
+    FCameraHotStepOutput PreviousSimulationStep;
+    FVector StepOscillationOffset;
+    FRotator StepDesiredRotation;
+
+    // Spring velocities for the game-thread modifiers
+    FRotator FramingVelocity;
+    FRotator TerrainTiltVelocity;
+
+    // **Framing**
+    FCameraFramingSet FramingTargets;
+
+    // Smoothed framing solution and how far the pose is blended towards it
+    FVector FramingCenter;
+    FVector FramingCenterVelocity;
+    float FramingDistance;
+    float FramingDistanceVelocity;
+    float FramingFOV;
+    float FramingFOVVelocity;
+    float FramingWeight;
+    float FramingWeightVelocity;
+
+    // Free distance along the latest framed boom sweep (world cm); negative when nothing blocks it
+    float FramingSafeDistance;
+
+    // **Camera Hints**
+    // Hint the owner stood in last frame, and the blended contribution of the current (or last) hint
+    TWeakObjectPtr<const ACameraHintVolume> ActiveHint;
+    float HintBlendSpeed;
+    float HintLagSpeed;
+    FVector HintOffset;
+    FVector HintOffsetVelocity;
+    float HintFOVDelta;
+    float HintFOVDeltaVelocity;
+    float HintLagWeight;
+    float HintLagWeightVelocity;
+
+    // World location trailing the pose at the hint's lag speed
+    FVector HintLagLocation;
+    FVector HintLagVelocity;
+    bool bHintLagValid;
+
+    // Targets derived from async probe results, held until the next result arrives
+    FRotator TerrainTargetTilt;
+    FVector CollisionPushBack;
+
+    // Safe boom length along the predicted path (-1 until known) and the smoothed length applied
+    float PredictionTargetDistance;
+    float PredictionDistance;
+    float PredictionDistanceVelocity;
+
+    // Path of the prediction sweep in flight, the predicted pivot it starts out from, and the pivot when it was requested
+    FVector PredictionSweepStart;
+    FVector PredictionSweepEnd;
+    FVector PredictionSweepPivot;
+    FVector PredictionSweepOrigin;
+
+    // **Autofocus**
+    // Nearest hit per frame over the last few frames; the median rejects single-frame spikes
+    static constexpr int32 AutofocusHistorySize = 5;
+    float AutofocusHistory[AutofocusHistorySize];
+    int32 AutofocusHistoryNum;
+    int32 AutofocusHistoryHead;
+
+    float AutofocusDistance;
+    float AutofocusVelocity;
+
+    // Focal distance last written to the depth of field layer, -1 before the first write
+    float AppliedFocusDistance;
+
+    // **Scene Queries**
+    FCameraQueryBatcher QueryBatcher;
+    FCameraProbeCache CollisionProbeCache;
+    FCameraProbeCache PredictionProbeCache;
 
-    // **Additional Variables**
-    float LastObstacleDetectionTime;
+    // **Camera Shakes**
+    FCameraShakeBank ShakeBank;
+
+    // **Pose Replay**
+    FCameraPoseRecorder PoseRecorder;
+
+    // Length and rate PoseRecorder was initialized with; it is only rebuilt, losing its history, when these change
+    float PoseRecorderSeconds;
+    float PoseRecorderRate;
+
+    UPROPERTY(Transient)
+    UCustomCameraComponent* ReplaySource;
+
+    // Replay position and end as fractional serials into the source's recorder
+    double ReplaySerial;
+    double ReplayEndSerial;
+    float ReplayPlayRate;
+    bool bReplayingPoses;
+
+    // Layer weights to restore when the replay ends
+    float ReplaySavedLayerWeights[FCameraPostProcessStack::NumLayers];
+
+    void RecordPose(const FCameraFrameInput& Input, const FCameraPoseAccumulator& Pose);
+    void ApplyPoseReplay(const FCameraFrameInput& Input);
+
+    // **Spectator Replication**
+    // Owner -> server as delta packets, server -> clients as a replicated property that is only
+    // active while a remote player is spectating this pawn
+    UPROPERTY(ReplicatedUsing = OnRep_SpectatorPose)
+    FCameraSpectatorPose SpectatorPose;
+
+    UFUNCTION()
+    void OnRep_SpectatorPose();
+
+    UFUNCTION(Server, Unreliable)
+    void ServerSendSpectatorPose(const FCameraSpectatorPosePacket& Packet);
+
+    UFUNCTION(Client, Unreliable)
+    void ClientAckSpectatorPose(uint8 Sequence);
+
+    FCameraSpectatorPoseSender SpectatorSender;
+    FCameraSpectatorPoseReceiver SpectatorReceiver;
+    FCameraSpectatorPoseInterpolator SpectatorInterpolator;
+    bool bSpectatorViewRegistered;
+
+    void SendSpectatorPose(const FCameraFrameInput& Input, const FCameraPoseAccumulator& Pose);
+    void ReceiveSpectatorPose();
+
+    /** Server: whether a remote player's view target is this pawn */
+    bool IsSpectatedRemotely() const;
+
+    /** Whether the local player's view target is this pawn */
+    bool IsLocalViewTarget() const;
+
+    // **Effect Timeline**
+    FCameraEffectTimeline EffectTimeline;
+    FCameraEffectChannels EffectChannels;
+
+    // **Post Process**
+    // Layered state pushed into this camera's PostProcessSettings; never touches level volumes
+    FCameraPostProcessStack PostProcessStack;
+
+    // **Pose Pipeline**
+    // Driven by UCustomCameraSubsystem. Modifiers run in this order every frame and the pose is committed once
+    // (* = evaluated in the subsystem's batched pass, see FCameraHotStateArrays::Evaluate; stepped at
+    // CameraSimulationRate when set, with the pose interpolated between steps):
+    //   1. Base      - camera mode stack
+    //   2. FOV       - dynamic FOV*, dynamic zoom*, focus-based FOV*
+    //   3. Offsets   - over-shoulder*, contextual, head bob*, sway*
+    //   4. Collision - HandleCameraCollision, PredictAndPreventCollisions, obstacle detection
+    //   5. Rotation  - inertia*, intelligent framing, terrain tilt, recoil*
+    //   6. Additive  - effect timeline (warp FOV), procedural shakes
+    // Both halves run as the variant compiled for EnabledFeatures when one exists (see DispatchCameraFeatures)
+    FCameraFrameInput GatherFrameInput(float DeltaTime) const;
+    void ConsumeFreeCameraInput(const FCameraFrameInput& Input);
+    FCameraModeContext MakeModeContext(const FCameraFrameInput& Input) const;
+    void UpdateCinematicRail(const FCameraFrameInput& Input);
+    ECameraHotFeature BuildFeatureMask() const;
+    template<typename TFeatures>
+    void ApplySceneModifiers(const FCameraFrameInput& Input, const FCameraHotStepOutput& Simulated, FCameraPoseAccumulator& Pose, TFeatures Enabled);
+    void CommitPose(const FCameraFrameInput& Input, FCameraPoseAccumulator& Pose);
+    template<typename TFeatures>
+    void UpdateFrameEffects(const FCameraFrameInput& Input, TFeatures Enabled);
 
     // **AAA Features Functions**
     void PerformDynamicObstacleDetection();
-    void PerformDynamicZoom();
-    void UpdateContextualPositioning();
-    void UpdateIntelligentFraming();
-    void UpdateAdaptiveDepthOfField();
-    void PredictAndPreventCollisions();
-    void UpdateEnvironmentalAwareness();
-    void UpdateFocusBasedFOV();
-    void ApplyAdvancedMotionBlur();
+    void ApplyDynamicObstacleDetection(const FCameraFrameInput& Input, FCameraPoseAccumulator& Pose);
+    void UpdateContextualPositioning(const FCameraFrameInput& Input, FCameraPoseAccumulator& Pose);
+    void UpdateIntelligentFraming(const FCameraFrameInput& Input, FCameraPoseAccumulator& Pose);
+    void UpdateAdaptiveDepthOfField(const FCameraFrameInput& Input);
+    float UpdateAutofocus(const FCameraFrameInput& Input);
+    void PredictAndPreventCollisions(const FCameraFrameInput& Input, FCameraPoseAccumulator& Pose);
+    void ApplyAdvancedMotionBlur(const FCameraFrameInput& Input);
 
-    void UpdateWarpEffect(); // Warp effect update
+    void ApplyEffectTimeline(const FCameraFrameInput& Input, FCameraPoseAccumulator& Pose);
+    void ApplyEffectPostProcess();
 
     // Helper Functions
-    void HandleDynamicObjectTransparency();
+    void HandleDynamicObjectTransparency(const FCameraFrameInput& Input);
     void RestoreOccludedObjects();
-    void ApplyRecoil(float DeltaTime);
-    void ApplyCameraInertia(float DeltaTime);
-    void AdjustCameraFOV(float DeltaTime, float DesiredFOV);
     void InitializeCamera();
-    void UpdateCamera(float DeltaTime);
-    void UpdateCameraRotation(float DeltaTime);
-    void UpdateDynamicFOV(float DeltaTime);
-    void UpdateTransition(float DeltaTime);
-    void HandleCameraCollision();
-    void UpdateBasedOnTerrain();
+    void HandleCameraCollision(const FCameraFrameInput& Input, FCameraPoseAccumulator& Pose);
+    void UpdateBasedOnTerrain(const FCameraFrameInput& Input, FCameraPoseAccumulator& Pose);
     void ClampRotation(FRotator& Rotation);
-    void ApplyTransitionEffects();
-    void ApplyHeadBobbing(float DeltaTime, bool bIsRunningLocal);
-    void ApplyCameraSway(float DeltaTime);
     void SetupPostProcessMaterial();
     bool IsInFirstPersonMode() const;
-    void SetCustomFOV(float NewFOV);
+
+    // **Net Role Gating**
+    // Dedicated servers never register with the camera subsystem; elsewhere only a locally controlled owner does
+    bool CanEverUpdateCamera() const;
+    bool ShouldUpdateCamera() const;
+    void SetCameraUpdatesActive(bool bActive);
+
+    /** Runs the obstacle detection timer at the profile's interval while updates are active and the feature is on */
+    void RefreshObstacleDetectionTimer();
+
+    UFUNCTION()
+    void OnOwnerControllerChanged(APawn* Pawn, AController* OldController, AController* NewController);
+
+    bool bCameraUpdatesActive;
+
+    UPROPERTY(Transient)
+    UCustomCameraSubsystem* CameraSubsystem;
+
+    // Frame input gathered for the batch in flight, consumed by ApplyCameraUpdate
+    FCameraFrameInput PendingFrameInput;
+
+    // Bumped by every gameplay-facing setter that changes the base pose (mode switches, transitions,
+    // SetCustomFOV); a batch gathered before the change must not write its stale FOV back over it
+    uint32 BasePoseSerial;
+    uint32 GatheredBasePoseSerial;
+
+    // Resolved once on registration; the owner of a camera component does not change
+    UPROPERTY(Transient)
+    APawn* CachedOwnerPawn;
+
+    // Free camera movement input accumulated between ticks, applied with the frame's delta time
+    FVector2D PendingFreeCameraInput;
 };
@@ -0,0 +1,445 @@
+// CustomCameraProfile.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "AlphaBlend.h"
+#include "CameraShakeAction.h"
+#include "CustomCameraProfile.generated.h"
+
+class UMaterialInterface;
+class UCurveFloat;
+class USoundBase;
+class UCustomCameraProfile;
+
+#if WITH_EDITOR
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnCustomCameraProfileChanged, const UCustomCameraProfile*);
+#endif
+
+/**
+ * Camera tuning shared by every UCustomCameraComponent that references it: positions, FOVs,
+ * feature toggles, effect parameters and materials. Components keep only their runtime state and
+ * read tuning through the profile, so a level full of characters holds one copy per profile.
+ * Edits in the editor are picked up by running cameras immediately.
+ */
+UCLASS(BlueprintType)
+class CUSTOMCAMERA_API UCustomCameraProfile : public UPrimaryDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    UCustomCameraProfile();
+
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+
+    /** Broadcast after any profile is edited, so cameras using it re-apply baked settings */
+    static FOnCustomCameraProfileChanged OnProfileChanged;
+#endif
+
+    // **Camera Modes**
+    // Seconds a mode switch blends over; 0 cuts
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Modes", meta = (ClampMin = "0.0"))
+    float ModeBlendTime;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Modes")
+    EAlphaBlendOption ModeBlendOption;
+
+    // Multiplies the rail's own speed for this camera
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Cinematic")
+    float CinematicRailPlayRate;
+
+    // **Pose Replay**
+    // Records the committed pose into a fixed ring buffer for killcams and instant replay
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Replay")
+    bool bRecordPoses;
+
+    // History kept; read when the profile is applied
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Replay", meta = (EditCondition = "bRecordPoses", ClampMin = "0.0"))
+    float PoseRecordSeconds;
+
+    // Recorded frames per second; read when the profile is applied
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Replay", meta = (EditCondition = "bRecordPoses", ClampMin = "1.0"))
+    float PoseRecordRate;
+
+    // **Spectating**
+    // Replicates the owner's final camera pose so spectators see recoil, FOV, mode blends and shakes
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Spectating")
+    bool bReplicateToSpectators;
+
+    // Fastest send rate, used while the pose is changing faster than the thresholds below
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Spectating", meta = (EditCondition = "bReplicateToSpectators", ClampMin = "0.0"))
+    float SpectatorMinSendInterval;
+
+    // Slowest send rate, used while the pose drifts by less than the thresholds
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Spectating", meta = (EditCondition = "bReplicateToSpectators", ClampMin = "0.0"))
+    float SpectatorMaxSendInterval;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Spectating", meta = (EditCondition = "bReplicateToSpectators", ClampMin = "0.0"))
+    float SpectatorLocationThreshold;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Spectating", meta = (EditCondition = "bReplicateToSpectators", ClampMin = "0.0"))
+    float SpectatorRotationThreshold;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Spectating", meta = (EditCondition = "bReplicateToSpectators", ClampMin = "0.0"))
+    float SpectatorFOVThreshold;
+
+    // Spectators play received poses back this far behind arrival so they can interpolate between them
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Spectating", meta = (EditCondition = "bReplicateToSpectators", ClampMin = "0.0"))
+    float SpectatorInterpolationDelay;
+
+    // **AAA Features**
+    // Dynamic Obstacle Detection
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Dynamic Obstacle Detection")
+    bool bEnableDynamicObstacleDetection;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Dynamic Obstacle Detection", meta = (EditCondition = "bEnableDynamicObstacleDetection"))
+    float ObstacleDetectionInterval;
+
+    // Dynamic Zoom
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Dynamic Zoom")
+    bool bEnableDynamicZoom;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Dynamic Zoom", meta = (EditCondition = "bEnableDynamicZoom"))
+    float DynamicZoomThreshold;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Dynamic Zoom", meta = (EditCondition = "bEnableDynamicZoom"))
+    float DynamicZoomSpeed;
+
+    // Contextual Positioning: applies the camera hint volume the owner stands in
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Contextual Positioning")
+    bool bEnableContextualPositioning;
+
+    // Intelligent Framing
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Intelligent Framing")
+    bool bEnableIntelligentFraming;
+
+    // Keeps the owner in frame together with the framing targets
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Intelligent Framing", meta = (EditCondition = "bEnableIntelligentFraming"))
+    bool bFrameOwner;
+
+    // Radius framed around the owner's location (cm)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Intelligent Framing", meta = (EditCondition = "bEnableIntelligentFraming && bFrameOwner", ClampMin = "0.0"))
+    float FramingOwnerRadius;
+
+    // Range the camera may keep from the centre of the framed group (cm)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Intelligent Framing", meta = (EditCondition = "bEnableIntelligentFraming", ClampMin = "0.0"))
+    float FramingMinDistance;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Intelligent Framing", meta = (EditCondition = "bEnableIntelligentFraming", ClampMin = "0.0"))
+    float FramingMaxDistance;
+
+    // Once at the maximum distance the FOV widens up to this to keep the group in frame
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Intelligent Framing", meta = (EditCondition = "bEnableIntelligentFraming", ClampMin = "5.0", ClampMax = "170.0"))
+    float FramingMaxFOV;
+
+    // Fraction of each half of the screen kept clear around the group
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Intelligent Framing", meta = (EditCondition = "bEnableIntelligentFraming", ClampMin = "0.0", ClampMax = "0.9"))
+    float FramingScreenMargin;
+
+    // How quickly the camera follows the framing solution
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Intelligent Framing", meta = (EditCondition = "bEnableIntelligentFraming", ClampMin = "0.0"))
+    float FramingSpeed;
+
+    // Adaptive Depth of Field
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Adaptive Depth of Field")
+    bool bEnableAdaptiveDepthOfField;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Adaptive Depth of Field", meta = (EditCondition = "bEnableAdaptiveDepthOfField"))
+    float FocusDistance;
+
+    // Focuses on what is at the centre of the screen instead of at FocusDistance
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Adaptive Depth of Field", meta = (EditCondition = "bEnableAdaptiveDepthOfField"))
+    bool bEnableAutofocus;
+
+    // Async rays per frame: one down the centre, the rest in a ring around it
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Adaptive Depth of Field", meta = (EditCondition = "bEnableAdaptiveDepthOfField && bEnableAutofocus", ClampMin = "1", ClampMax = "8"))
+    int32 AutofocusRayCount;
+
+    // Angle of the ring from the view axis (degrees)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Adaptive Depth of Field", meta = (EditCondition = "bEnableAdaptiveDepthOfField && bEnableAutofocus", ClampMin = "0.0", ClampMax = "30.0"))
+    float AutofocusSpread;
+
+    // Focus distance used when the rays hit nothing (cm)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Adaptive Depth of Field", meta = (EditCondition = "bEnableAdaptiveDepthOfField && bEnableAutofocus", ClampMin = "1.0"))
+    float AutofocusMaxDistance;
+
+    // How quickly the focus pulls to a new distance
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Adaptive Depth of Field", meta = (EditCondition = "bEnableAdaptiveDepthOfField && bEnableAutofocus", ClampMin = "0.0"))
+    float AutofocusSpeed;
+
+    // Depth of field is only rewritten once the focus moves by more than this fraction of its distance
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Adaptive Depth of Field", meta = (EditCondition = "bEnableAdaptiveDepthOfField && bEnableAutofocus", ClampMin = "0.0", ClampMax = "0.5"))
+    float AutofocusUpdateThreshold;
+
+    // Collision Prediction
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Collision Prediction")
+    bool bEnableCollisionPrediction;
+
+    // How far ahead the camera path is predicted from the owner's velocity (seconds)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Collision Prediction", meta = (EditCondition = "bEnableCollisionPrediction", ClampMin = "0.0"))
+    float CollisionPredictionTime;
+
+    // Radius of the sphere swept along the predicted path (cm)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Collision Prediction", meta = (EditCondition = "bEnableCollisionPrediction", ClampMin = "0.0"))
+    float CollisionPredictionRadius;
+
+    // The sweep is only repeated once the predicted path has moved further than this (cm)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Collision Prediction", meta = (EditCondition = "bEnableCollisionPrediction", ClampMin = "0.0"))
+    float CollisionPredictionRecheckDistance;
+
+    // How quickly the boom follows the predicted safe distance
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Collision Prediction", meta = (EditCondition = "bEnableCollisionPrediction", ClampMin = "0.0"))
+    float CollisionPredictionSpeed;
+
+    // Focus-based FOV
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Focus-based FOV")
+    bool bEnableFocusBasedFOV;
+
+    // Advanced Motion Blur
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Advanced Motion Blur")
+    bool bEnableAdvancedMotionBlur;
+
+    // Camera Inertia
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Inertia")
+    bool bEnableCameraInertia;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|AAA Features|Inertia", meta = (EditCondition = "bEnableCameraInertia"))
+    float CameraInertiaStrength;
+
+    // Head Bobbing Settings
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|HeadBobbing")
+    bool bEnableHeadBobbing;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|HeadBobbing")
+    float RunningBobMagnitude;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|HeadBobbing")
+    float WalkingBobMagnitude;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|HeadBobbing")
+    float BobFrequency;
+
+    // Camera Sway Settings
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Sway")
+    bool bEnableCameraSway;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Sway")
+    float SwayAmount;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Sway")
+    float SwaySpeed;
+
+    // Rotation Settings
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Rotation")
+    float MaxYawRotation;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Rotation")
+    float MaxPitchRotation;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Rotation")
+    float RotationSpeed;
+
+    // Terrain Tilt
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Tilt")
+    bool bEnableTerrainTilt;
+
+    // Steps the batched camera simulation at this rate (Hz) and interpolates the pose between steps;
+    // 0 steps once per rendered frame. Springs are exact in delta time either way
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Simulation", meta = (ClampMin = "0.0"))
+    float CameraSimulationRate;
+
+    // Camera Lag
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Lag")
+    bool bEnableCameraLag;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Lag")
+    float CameraLagSpeed;
+
+    // Dynamic FOV
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|FOV")
+    bool bEnableDynamicFOV;
+
+    // Collision probe is traced synchronously so the camera never clips for a frame
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Collision")
+    bool bSynchronousCollisionProbe;
+
+    // Collision probe results are reused while the probe and owner move less than this (cm)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Collision")
+    float ProbeCacheLocationEpsilon;
+
+    // Collision probe results are reused while the probe direction turns less than this (degrees)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Collision")
+    float ProbeCacheAngleEpsilon;
+
+    // Cached hits expire after this (seconds); a moving hit primitive invalidates them sooner
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Collision")
+    float ProbeCacheMaxAge;
+
+    // Cached misses can't see objects moving into the probe (doors, vehicles), so they expire after this (seconds)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Collision", meta = (ClampMin = "0.0"))
+    float ProbeCacheMissMaxAge;
+
+    // Camera Height Constraints
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Collision")
+    float MinCameraHeight;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Collision")
+    float MaxCameraHeight;
+
+    // **Additional Materials**
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Effects")
+    UMaterialInterface* FadeMaterial;
+
+    // Optional fade shape over its own time range; a linear 0..1 ramp is used when unset
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Effects")
+    UCurveFloat* FadeCurve;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Effects")
+    UMaterialInterface* OcclusionMaterial;
+
+    // **Camera Positions**
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Positions")
+    FVector FirstPersonPosition;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Positions")
+    FVector ThirdPersonPosition;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Positions")
+    FVector AimPositionFirstPerson;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Positions")
+    FVector AimPositionThirdPerson;
+
+    // **FOV Settings**
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|FOV")
+    float DefaultFOV;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|FOV")
+    float AimingFOV;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|FOV")
+    float ZoomedFOV;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|FOV")
+    float SprintFOV;
+
+    // **PostProcess Settings**
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|PostProcess")
+    UMaterialInterface* PostProcessMaterial;
+
+    // Depth of Field
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|PostProcess")
+    float DepthOfField;
+
+    // Motion Blur Amount
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|PostProcess")
+    float MotionBlurAmount;
+
+    // Color Grading Intensity
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|PostProcess")
+    float ColorGradingIntensity;
+
+    // Vignette Intensity
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|PostProcess")
+    float VignetteIntensity;
+
+    // **Audio Settings for Warp Effect**
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|WarpEffect")
+    USoundBase* WarpSoundEffect;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|WarpEffect")
+    float WarpSoundVolumeMultiplier;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|WarpEffect")
+    float WarpSoundPitchMultiplier;
+
+    // **Warp Effect Parameters**
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|WarpEffect")
+    float WarpMaxFOVIncrease;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|WarpEffect")
+    float WarpDuration;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|WarpEffect")
+    float WarpVignetteIntensity;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|WarpEffect")
+    float WarpMotionBlurAmount;
+
+    // Optional warp shape over its own time range; when unset each channel rises and falls back as sin(pi * t)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|WarpEffect")
+    UCurveFloat* WarpCurve;
+
+    // **Camera Shakes**
+    // Procedural shake per action, played by TriggerCameraShakeAction; read when the profile is applied
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Shake")
+    TArray<FCameraShakeMapping> CameraShakeMappings;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera|Repositioning", meta = (EditCondition = "bEnableOverShoulderRepositioning"))
+    float RepositioningSpeed;
+
+    // Dynamic Object Transparency
+    UPROPERTY(EditAnywhere, Category = "Camera|Occlusion")
+    bool bEnableDynamicObjectTransparency;
+
+    UPROPERTY(EditAnywhere, Category = "Camera|Occlusion", meta = (EditCondition = "bEnableDynamicObjectTransparency"))
+    float OcclusionTransparencyStrength;
+
+    // Rays cast toward both the pawn's head and chest each sample
+    UPROPERTY(EditAnywhere, Category = "Camera|Occlusion", meta = (EditCondition = "bEnableDynamicObjectTransparency", ClampMin = "1", ClampMax = "8"))
+    int32 OcclusionRaysPerTarget;
+
+    UPROPERTY(EditAnywhere, Category = "Camera|Occlusion", meta = (EditCondition = "bEnableDynamicObjectTransparency", ClampMin = "0.0"))
+    float OcclusionFanRadius;
+
+    // Cast a single sphere sweep per target instead of the ray fan
+    UPROPERTY(EditAnywhere, Category = "Camera|Occlusion", meta = (EditCondition = "bEnableDynamicObjectTransparency"))
+    bool bOcclusionUseSphereSweep;
+
+    UPROPERTY(EditAnywhere, Category = "Camera|Occlusion", meta = (EditCondition = "bEnableDynamicObjectTransparency && bOcclusionUseSphereSweep", ClampMin = "0.0"))
+    float OcclusionSweepRadius;
+
+    // Hits within the last 8 samples required before an occluder starts fading
+    UPROPERTY(EditAnywhere, Category = "Camera|Occlusion", meta = (EditCondition = "bEnableDynamicObjectTransparency", ClampMin = "1", ClampMax = "8"))
+    int32 OcclusionFadeInSamples;
+
+    // Consecutive missed samples before an occluder fades back
+    UPROPERTY(EditAnywhere, Category = "Camera|Occlusion", meta = (EditCondition = "bEnableDynamicObjectTransparency", ClampMin = "1", ClampMax = "8"))
+    int32 OcclusionFadeOutSamples;
+
+    UPROPERTY(EditAnywhere, Category = "Camera|Occlusion", meta = (EditCondition = "bEnableDynamicObjectTransparency", ClampMin = "1"))
+    int32 MaxTrackedOccluders;
+
+    // Custom Primitive Data slot the occluder materials read their fade amount from
+    UPROPERTY(EditAnywhere, Category = "Camera|Occlusion", meta = (EditCondition = "bEnableDynamicObjectTransparency", ClampMin = "0"))
+    int32 OcclusionFadeDataIndex;
+
+    UPROPERTY(EditAnywhere, Category = "Camera|Occlusion", meta = (EditCondition = "bEnableDynamicObjectTransparency", ClampMin = "0.0"))
+    float OcclusionFadeInTime;
+
+    UPROPERTY(EditAnywhere, Category = "Camera|Occlusion", meta = (EditCondition = "bEnableDynamicObjectTransparency", ClampMin = "0.0"))
+    float OcclusionFadeOutTime;
+
+    // Over-the-Shoulder Repositioning
+    UPROPERTY(EditAnywhere, Category = "Camera|Repositioning")
+    bool bEnableOverShoulderRepositioning;
+
+    UPROPERTY(EditAnywhere, Category = "Camera|Repositioning", meta = (EditCondition = "bEnableOverShoulderRepositioning"))
+    FVector OverShoulderOffset;
+
+    // Recoil System
+    UPROPERTY(EditAnywhere, Category = "Camera|Recoil")
+    bool bEnableRecoil;
+
+    UPROPERTY(EditAnywhere, Category = "Camera|Recoil", meta = (EditCondition = "bEnableRecoil"))
+    float RecoilIntensity;
+
+    UPROPERTY(EditAnywhere, Category = "Camera|Recoil", meta = (EditCondition = "bEnableRecoil"))
+    float RecoilRecoverySpeed;
+
+    // Advanced Motion Blur
+    UPROPERTY(EditAnywhere, Category = "Camera|MotionBlur", meta = (EditCondition = "bEnableAdvancedMotionBlur"))
+    float MotionBlurIntensityMultiplier;
+};
@@ -0,0 +1,89 @@
+// CustomCameraSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "CameraHotState.h"
+#include "CameraHintGrid.h"
+#include "CustomCameraSubsystem.generated.h"
+
+class UCustomCameraComponent;
+class UCustomCameraSubsystem;
+class ACameraHintVolume;
+
+// Phase of the camera batch a tick function runs
+enum class ECustomCameraTickPhase : uint8
+{
+    // Game thread: gather hot state and dispatch the evaluate task
+    Gather,
+    // Game thread: wait for evaluation (via prerequisites), write back and commit
+    Apply
+};
+
+// Drives one phase of the camera batch for every registered camera
+struct FCustomCameraTickFunction : public FTickFunction
+{
+    UCustomCameraSubsystem* Subsystem = nullptr;
+    ECustomCameraTickPhase Phase = ECustomCameraTickPhase::Gather;
+
+    virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+    virtual FString DiagnosticMessage() override;
+};
+
+/**
+ * Updates all custom cameras in a world as one batch instead of one component tick each:
+ * gather every camera's hot state on the game thread, evaluate all desired poses in a single
+ * ParallelFor over structure-of-arrays data, then let each camera apply its pose.
+ *
+ * Gather runs in TG_DuringPhysics and hands evaluation to a task-graph task, so the game thread
+ * keeps ticking other work (and physics runs) while poses are evaluated. Apply runs in
+ * TG_PostPhysics, before the player camera managers build the view, and depends on the gather
+ * tick, whose completion is held until the evaluate task finishes.
+ */
+UCLASS()
+class CUSTOMCAMERA_API UCustomCameraSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+    void RegisterCamera(UCustomCameraComponent* Camera);
+    void UnregisterCamera(UCustomCameraComponent* Camera);
+
+    /** Remote players' cameras that follow a replicated pose; updated after the batch is applied */
+    void RegisterSpectatorCamera(UCustomCameraComponent* Camera);
+    void UnregisterSpectatorCamera(UCustomCameraComponent* Camera);
+
+    /** Camera hint volumes, kept in a uniform grid so a camera finds its hint without probing the scene */
+    void RegisterCameraHint(const ACameraHintVolume* Volume);
+    void UnregisterCameraHint(const ACameraHintVolume* Volume);
+    const ACameraHintVolume* FindCameraHint(const FVector& Location) const { return HintGrid.Find(Location); }
+
+    void GatherCameras(float DeltaTime, const FGraphEventRef& GatherCompletionEvent);
+    void ApplyCameras();
+
+private:
+    void WaitForEvaluation();
+
+    UPROPERTY(Transient)
+    TArray<UCustomCameraComponent*> Cameras;
+
+    // Cameras in the batch in flight, by hot state index; entries are cleared if a camera unregisters mid-batch
+    TArray<TWeakObjectPtr<UCustomCameraComponent>> BatchCameras;
+
+    TArray<TWeakObjectPtr<UCustomCameraComponent>> SpectatorCameras;
+
+    FCameraHintGrid HintGrid;
+
+    // Only the evaluate task touches HotState between gather and apply
+    FCameraHotStateArrays HotState;
+    FGraphEventRef EvaluateEvent;
+
+    FCustomCameraTickFunction GatherTickFunction;
+    FCustomCameraTickFunction ApplyTickFunction;
+};
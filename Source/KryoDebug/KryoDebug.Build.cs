@@ -0,0 +1,21 @@
+using UnrealBuildTool;
+using System.IO;
+
+public class KryoDebug : ModuleRules
+{
+    public KryoDebug(ReadOnlyTargetRules Target) : base(Target)
+    {
+        PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+        PublicDependencyModuleNames.AddRange(new string[]
+        {
+            "Core",
+            "CoreUObject",
+            "Engine"
+        });
+
+        // Include paths
+        PublicIncludePaths.Add(Path.Combine(ModuleDirectory, "Public"));
+        PrivateIncludePaths.Add(Path.Combine(ModuleDirectory, "Private"));
+    }
+}
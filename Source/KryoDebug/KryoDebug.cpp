@@ -0,0 +1,25 @@
+#include "KryoDebug.h"
+#include "KryoDebugDraw.h"
+#include "Modules/ModuleManager.h"
+#include "Engine/World.h"
+
+void FKryoDebugModule::StartupModule()
+{
+#if KRYO_DEBUG_DRAW
+    // Everything queued during the frame goes to the line batcher in one call once actors have ticked
+    PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddLambda([](UWorld* World, ELevelTick, float)
+    {
+        KryoDebug::FlushWorld(World);
+    });
+#endif
+}
+
+void FKryoDebugModule::ShutdownModule()
+{
+#if KRYO_DEBUG_DRAW
+    FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+    KryoDebug::DiscardAll();
+#endif
+}
+
+IMPLEMENT_MODULE(FKryoDebugModule, KryoDebug)
\ No newline at end of file
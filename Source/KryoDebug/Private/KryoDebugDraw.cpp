@@ -0,0 +1,115 @@
+#include "KryoDebugDraw.h"
+
+#if KRYO_DEBUG_DRAW
+
+#include "HAL/IConsoleManager.h"
+#include "Engine/World.h"
+#include "Components/LineBatchComponent.h"
+#include "DrawDebugHelpers.h"
+
+namespace
+{
+    TAutoConsoleVariable<int32> CVarKryoCameraDebug(
+        TEXT("kryo.Camera.Debug"),
+        0,
+        TEXT("Draws camera probes and effect state. 0: off, 1: on"),
+        ECVF_Cheat);
+
+    TAutoConsoleVariable<int32> CVarKryoGripDebug(
+        TEXT("kryo.Grip.Debug"),
+        0,
+        TEXT("Draws hand and finger IK targets. 0: off, 1: on"),
+        ECVF_Cheat);
+
+    struct FQueuedString
+    {
+        FVector Location;
+        FString Text;
+        FColor Color;
+    };
+
+    struct FWorldBatch
+    {
+        // Single-frame lines and lines with a lifetime go to different batchers, as with DrawDebugLine
+        TArray<FBatchedLine> Lines;
+        TArray<FBatchedLine> TimedLines;
+        TArray<FQueuedString> Strings;
+    };
+
+    // Only touched on the game thread
+    TMap<TWeakObjectPtr<const UWorld>, FWorldBatch> PendingBatches;
+}
+
+bool KryoDebug::IsEnabled(EKryoDebugCategory Category)
+{
+    switch (Category)
+    {
+    case EKryoDebugCategory::Camera:
+        return CVarKryoCameraDebug.GetValueOnGameThread() != 0;
+    case EKryoDebugCategory::Grip:
+        return CVarKryoGripDebug.GetValueOnGameThread() != 0;
+    default:
+        return false;
+    }
+}
+
+void KryoDebug::QueueLine(const UWorld* World, const FVector& Start, const FVector& End, const FColor& Color, float LifeTime, float Thickness)
+{
+    check(IsInGameThread());
+    if (!World || World->IsNetMode(NM_DedicatedServer))
+    {
+        return;
+    }
+
+    FWorldBatch& Batch = PendingBatches.FindOrAdd(World);
+    if (LifeTime > 0.0f)
+    {
+        Batch.TimedLines.Emplace(Start, End, FLinearColor(Color), LifeTime, Thickness, SDPG_World);
+    }
+    else
+    {
+        Batch.Lines.Emplace(Start, End, FLinearColor(Color), 0.0f, Thickness, SDPG_World);
+    }
+}
+
+void KryoDebug::QueueString(const UWorld* World, const FVector& Location, const FString& Text, const FColor& Color)
+{
+    check(IsInGameThread());
+    if (!World || World->IsNetMode(NM_DedicatedServer))
+    {
+        return;
+    }
+
+    PendingBatches.FindOrAdd(World).Strings.Add({ Location, Text, Color });
+}
+
+void KryoDebug::FlushWorld(UWorld* World)
+{
+    FWorldBatch Batch;
+    if (!World || !PendingBatches.RemoveAndCopyValue(World, Batch))
+    {
+        return;
+    }
+
+    if (Batch.Lines.Num() > 0 && World->LineBatcher)
+    {
+        World->LineBatcher->DrawLines(Batch.Lines);
+    }
+
+    if (Batch.TimedLines.Num() > 0 && World->PersistentLineBatcher)
+    {
+        World->PersistentLineBatcher->DrawLines(Batch.TimedLines);
+    }
+
+    for (const FQueuedString& String : Batch.Strings)
+    {
+        DrawDebugString(World, String.Location, String.Text, nullptr, String.Color, 0.0f);
+    }
+}
+
+void KryoDebug::DiscardAll()
+{
+    PendingBatches.Empty();
+}
+
+#endif // KRYO_DEBUG_DRAW
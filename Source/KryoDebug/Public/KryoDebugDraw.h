@@ -0,0 +1,50 @@
+// KryoDebugDraw.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorld;
+
+// Debug drawing only exists in Debug and Development builds
+#define KRYO_DEBUG_DRAW !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+
+// Systems that can be visualized independently; each has its own console variable
+enum class EKryoDebugCategory : uint8
+{
+    Camera,     // kryo.Camera.Debug
+    Grip        // kryo.Grip.Debug
+};
+
+#if KRYO_DEBUG_DRAW
+
+/**
+ * Debug-draw facade. Primitives are queued per world and handed to the line batcher in a single
+ * batch after actors tick, instead of one line batcher call per primitive. Use the KRYO_DEBUG_*
+ * macros rather than calling these directly so the arguments vanish from Shipping and Test builds.
+ */
+namespace KryoDebug
+{
+    KRYODEBUG_API bool IsEnabled(EKryoDebugCategory Category);
+
+    /** LifeTime <= 0 draws for a single frame */
+    KRYODEBUG_API void QueueLine(const UWorld* World, const FVector& Start, const FVector& End, const FColor& Color, float LifeTime, float Thickness);
+    KRYODEBUG_API void QueueString(const UWorld* World, const FVector& Location, const FString& Text, const FColor& Color);
+
+    /** Submits and clears everything queued for World */
+    KRYODEBUG_API void FlushWorld(UWorld* World);
+    KRYODEBUG_API void DiscardAll();
+}
+
+#define KRYO_DEBUG_LINE(World, Category, Start, End, Color, LifeTime) \
+    do { if (KryoDebug::IsEnabled(Category)) { KryoDebug::QueueLine((World), (Start), (End), (Color), (LifeTime), 1.0f); } } while (0)
+
+#define KRYO_DEBUG_STRING(World, Category, Location, Text, Color) \
+    do { if (KryoDebug::IsEnabled(Category)) { KryoDebug::QueueString((World), (Location), (Text), (Color)); } } while (0)
+
+#else
+
+#define KRYO_DEBUG_LINE(World, Category, Start, End, Color, LifeTime) do { } while (0)
+#define KRYO_DEBUG_STRING(World, Category, Location, Text, Color) do { } while (0)
+
+#endif
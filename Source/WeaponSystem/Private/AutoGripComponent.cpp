@@ -2,7 +2,7 @@
 #include "WeaponBase.h" // Included here to access AWeaponBase and its GetGripTransform() function.
 #include "Components/SkeletalMeshComponent.h"
 #include "Kismet/KismetMathLibrary.h"
-#include "DrawDebugHelpers.h"
+#include "KryoDebugDraw.h"
 
 UAutoGripComponent::UAutoGripComponent()
 {
@@ -80,10 +80,8 @@ void UAutoGripComponent::MoveHandToSocket(USkeletalMeshComponent* PlayerMesh, co
         return;
     }
 
-    FVector BoneWorldLocation = PlayerMesh->GetBoneLocation(HandBone);
-
-    // Debugging visualization: draw a line from the bone's world location to the target.
-    DrawDebugLine(GetWorld(), BoneWorldLocation, TargetLocation, FColor::Green, false, 2.0f, 0, 1.0f);
+    // Debugging visualization: draw a line from the bone's world location to the target (kryo.Grip.Debug).
+    KRYO_DEBUG_LINE(GetWorld(), EKryoDebugCategory::Grip, PlayerMesh->GetBoneLocation(HandBone), TargetLocation, FColor::Green, 2.0f);
 }
 
 void UAutoGripComponent::AdjustFingerIK()
@@ -121,8 +119,8 @@ void UAutoGripComponent::ApplyFingerIK(USkeletalMeshComponent* PlayerMesh, const
             // Calculate the rotation needed to look at the current target.
             FRotator NewRotation = UKismetMathLibrary::FindLookAtRotation(BoneLocation, CurrentTarget);
 
-            // Draw a debug line from the bone to the current target.
-            DrawDebugLine(GetWorld(), BoneLocation, CurrentTarget, FColor::Red, false, 1.0f, 0, 1.0f);
+            // Draw a debug line from the bone to the current target (kryo.Grip.Debug).
+            KRYO_DEBUG_LINE(GetWorld(), EKryoDebugCategory::Grip, BoneLocation, CurrentTarget, FColor::Red, 1.0f);
 
             // Update target for the next bone in the chain.
             CurrentTarget = BoneLocation;
@@ -27,7 +27,8 @@ public class WeaponSystem : ModuleRules
         {
             "GameplayAbilities",
             "GameplayTags",
-            "GameplayTasks"
+            "GameplayTasks",
+            "KryoDebug"    // Debug visualization, compiled out of Shipping and Test
         });
 
         // Add the Public and Private directories explicitly
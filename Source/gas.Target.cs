@@ -7,6 +7,6 @@ public class gasTarget : TargetRules
         Type = TargetType.Game;
         DefaultBuildSettings = BuildSettingsVersion.V5;
         IncludeOrderVersion = EngineIncludeOrderVersion.Latest;
-        ExtraModuleNames.AddRange(new string[] { "PlayerCharacter", "WeaponSystem", "CustomCamera" });
+        ExtraModuleNames.AddRange(new string[] { "PlayerCharacter", "WeaponSystem", "CustomCamera", "KryoDebug" });
     }
 }
\ No newline at end of file
@@ -8,6 +8,6 @@ public class gasEditorTarget : TargetRules
         Type = TargetType.Editor;
         DefaultBuildSettings = BuildSettingsVersion.V5;
         IncludeOrderVersion = EngineIncludeOrderVersion.Latest;
-        ExtraModuleNames.AddRange(new string[] { "PlayerCharacter", "WeaponSystem", "CustomCamera" });
+        ExtraModuleNames.AddRange(new string[] { "PlayerCharacter", "WeaponSystem", "CustomCamera", "KryoDebug" });
     }
 }
\ No newline at end of file